@@ -7,14 +7,37 @@
 #include "ast_decl.h"
 #include <string.h> // strdup
 #include <stdio.h>  // printf
+#include "intern.h"
+
+thread_local SourceBuffer *Node::printSource = NULL;
+
+#ifndef COMPACT_LOCATIONS
+static AllocBucket locations("yyltype (Node::location)", MemLocations);
+#endif
+
+void *Node::operator new(size_t size) {
+    void *node = ::operator new(size);
+    if (MemStats::IsOn()) MemStats::NodeAllocated(node, size);
+    return node;
+}
 
 Node::Node(yyltype loc) {
+#ifdef COMPACT_LOCATIONS
+    location = loc;
+#else
     location = new yyltype(loc);
+    if (MemStats::IsOn()) MemStats::Allocated(&locations, sizeof(yyltype));
+#endif
     parent = NULL;
 }
 
 Node::Node() {
+#ifdef COMPACT_LOCATIONS
+    location.offset = NoLocation;
+    location.length = 0;
+#else
     location = NULL;
+#endif
     parent = NULL;
 }
 
@@ -28,18 +51,27 @@ Node::Node() {
  */
 void Node::Print(int indentLevel, const char *label) { 
     const int numSpaces = 3;
+    SourceBuffer *outer = printSource;
+    if (outer == NULL) printSource = GetSource();  // the top of this print
+#ifdef COMPACT_LOCATIONS
+    bool numbered = GetLocation() && printSource;
+#else
+    bool numbered = GetLocation() != NULL;
+#endif
     printf("\n");
-    if (GetLocation()) 
-        printf("%*d", numSpaces, GetLocation()->first_line);
+    if (numbered) 
+        printf("%*d", numSpaces, GetPosition(printSource, GetLocation()).line);
     else 
         printf("%*s", numSpaces, "");
     printf("%*s%s%s: ", indentLevel*numSpaces, "", 
            label? label : "", GetPrintNameForNode());
    PrintChildren(indentLevel);
+   printSource = outer;
 } 
 	 
-Identifier::Identifier(yyltype loc, const char *n) : Node(loc) {
-    name = strdup(n);
+Identifier::Identifier(yyltype loc, int s) : Node(loc) {
+    symbol = s;
+    name = InternTable::GetName(s);
 } 
 
 void Identifier::PrintChildren(int indentLevel) {
@@ -10,6 +10,9 @@
  * file), that location can be NULL for those nodes that don't care/use 
  * locations. The location is typically set by the node constructor.  The 
  * location is used to provide the context when reporting semantic errors.
+ * (With compact locations, see location.h, the node holds its location
+ * itself rather than pointing to a copy, and a node without one has an
+ * offset of NoLocation.)
  *
  * Parent: Each node has a pointer to its parent. For a Program node, the 
  * parent is NULL, for all other nodes it is the pointer to the node one level
@@ -25,6 +28,9 @@
  * PrintChildren() and GetPrintNameForNode() methods. All the classes we 
  * provide already implement these methods, so your job is to construct the
  * nodes and wire them up during parsing. Once that's done, printing is a snap!
+ * (With compact locations, line numbers are looked up in the input the tree
+ * was parsed from, which the Program at its root knows. Any subtree can be
+ * printed; one that isn't under a Program yet is printed without them.)
 
  */
 
@@ -33,21 +39,44 @@
 
 #include <stdlib.h>   // for NULL
 #include "location.h"
+#include "memstats.h"
 
 class Node 
 {
   protected:
+#ifdef COMPACT_LOCATIONS
+    static const uint32_t NoLocation = UINT32_MAX;
+    yyltype location;
+#else
     yyltype *location;
+#endif
     Node *parent;
 
+    // The input of the tree this thread is printing, which Print finds
+    // with GetSource when it starts
+    static thread_local SourceBuffer *printSource;
+
   public:
     Node(yyltype loc);
     Node();
+
+    // All nodes are allocated through here so the allocation census
+    // (see memstats.h) can tally them by class
+    static void *operator new(size_t size);
+    static void operator delete(void *node) { ::operator delete(node); }
     
+#ifdef COMPACT_LOCATIONS
+    yyltype *GetLocation()   { return location.offset == NoLocation ? NULL : &location; }
+#else
     yyltype *GetLocation()   { return location; }
+#endif
     void SetParent(Node *p)  { parent = p; }
     Node *GetParent()        { return parent; }
 
+    // The input the tree was parsed from, kept by the Program at its
+    // root, or NULL if the node isn't under a Program
+    virtual SourceBuffer *GetSource() { return parent ? parent->GetSource() : NULL; }
+
     virtual const char *GetPrintNameForNode() = 0;
     
     // Print() is deliberately _not_ virtual
@@ -57,13 +86,18 @@ class Node
 };
    
 
+// The name is interned (see intern.h): an Identifier holds the name's
+// symbol, and the name points to the table's copy of it.
 class Identifier : public Node 
 {
   protected:
-    char *name;
+    int symbol;
+    const char *name;
     
   public:
-    Identifier(yyltype loc, const char *name);
+    Identifier(yyltype loc, int symbol);
+    int GetSymbol()                     { return symbol; }
+    const char *GetName()               { return name; }
     const char *GetPrintNameForNode()   { return "Identifier"; }
     void PrintChildren(int indentLevel);
 };
@@ -24,6 +24,7 @@ class Decl : public Node
   
   public:
     Decl(Identifier *name);
+    Identifier *GetId()                 { return id; }
 };
 
 class VarDecl : public Decl 
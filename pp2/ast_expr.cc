@@ -30,12 +30,12 @@ void BoolConstant::PrintChildren(int indentLevel) {
     printf("%s", value ? "true" : "false");
 }
 
-StringConstant::StringConstant(yyltype loc, const char *val) : Expr(loc) {
-    Assert(val != NULL);
-    value = strdup(val);
+StringConstant::StringConstant(yyltype loc, TextSpan val) : Expr(loc) {
+    Assert(val.text != NULL);
+    value = val;
 }
 void StringConstant::PrintChildren(int indentLevel) { 
-    printf("%s",value);
+    printf("%.*s", value.length, value.text);
 }
 
 Operator::Operator(yyltype loc, const char *tok) : Node(loc) {
@@ -70,10 +70,11 @@ class BoolConstant : public Expr
 class StringConstant : public Expr 
 { 
   protected:
-    char *value;
+    TextSpan value;   // in the source buffer, quotes and all (so only
+                      // good while it is, see TextSpan in location.h)
     
   public:
-    StringConstant(yyltype loc, const char *val);
+    StringConstant(yyltype loc, TextSpan val);
     const char *GetPrintNameForNode() { return "StringConstant"; }
     void PrintChildren(int indentLevel);
 };
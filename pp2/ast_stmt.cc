@@ -8,9 +8,10 @@
 #include "ast_expr.h"
 
 
-Program::Program(List<Decl*> *d) {
+Program::Program(List<Decl*> *d, SourceBuffer *s) {
     Assert(d != NULL);
     (decls=d)->SetParentAll(this);
+    source = s;
 }
 
 void Program::PrintChildren(int indentLevel) {
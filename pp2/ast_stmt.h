@@ -56,10 +56,13 @@ class Program : public Node
 {
   protected:
      List<Decl*> *decls;
+     SourceBuffer *source;   // the input the tree was parsed from, which
+                             // its CompileContext frees (see context.h)
      
   public:
-     Program(List<Decl*> *declList);
+     Program(List<Decl*> *declList, SourceBuffer *source);
      const char *GetPrintNameForNode() { return "Program"; }
+     SourceBuffer *GetSource()         { return source; }
      void PrintChildren(int indentLevel);
 };
 
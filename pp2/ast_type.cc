@@ -6,6 +6,7 @@
 #include "ast_decl.h"
 #include <string.h>
 
+static AllocBucket typeNames("Type::typeName", MemStrings);
  
 /* Class constants
  * ---------------
@@ -25,7 +26,7 @@ Type *Type::errorType  = new Type("error");
 
 Type::Type(const char *n) {
     Assert(n);
-    typeName = strdup(n);
+    typeName = MemStats::Strdup(n, &typeNames);
 }
 
 void Type::PrintChildren(int indentLevel) {
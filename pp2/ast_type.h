@@ -22,8 +22,12 @@ class Type : public Node
     static Type *intType, *doubleType, *boolType, *voidType,
                 *nullType, *stringType, *errorType;
 
-    Type(yyltype loc) : Node(loc) {}
+    Type(yyltype loc) : Node(loc) { typeName = NULL; }
     Type(const char *str);
+
+    // The built-in types are shared by every tree, and by every thread
+    // building one, so they are never written to: they keep no parent
+    void SetParent(Node *p) { if (typeName == NULL) Node::SetParent(p); }
     
     const char *GetPrintNameForNode() { return "Type"; }
     void PrintChildren(int indentLevel);
@@ -0,0 +1,142 @@
+/* File: charscan.h
+ * ----------------
+ * Character classes and run skipping shared by the two scanners. The
+ * hand-written scanner (handscan.cc) finds the end of nearly every token
+ * with these; the flex one (scanner.l) uses them to get over blanks and
+ * comments, which otherwise cost it a step of its automaton per byte.
+ */
+
+#ifndef _H_charscan
+#define _H_charscan
+
+#include <stdint.h>
+
+/* Character classes
+ * -----------------
+ * The first character of a token is looked up in charClass to decide
+ * what kind of token it starts; the scalar loops that skip runs use the
+ * same table.
+ */
+enum { ClassLetter = 1, ClassDigit = 2, ClassUnderscore = 4, ClassBlank = 8,
+       ClassHexDigit = 16, ClassOperator = 32 };
+
+struct CharClassTable {
+  unsigned char bits[256];
+  constexpr CharClassTable() : bits()
+  {
+    for (int c = 'a'; c <= 'z'; c++) bits[c] |= ClassLetter;
+    for (int c = 'A'; c <= 'Z'; c++) bits[c] |= ClassLetter;
+    for (int c = '0'; c <= '9'; c++) bits[c] |= ClassDigit | ClassHexDigit;
+    for (int c = 'a'; c <= 'f'; c++) bits[c] |= ClassHexDigit;
+    for (int c = 'A'; c <= 'F'; c++) bits[c] |= ClassHexDigit;
+    bits['_'] |= ClassUnderscore;
+    bits[' '] |= ClassBlank;
+    bits['\n'] |= ClassBlank;
+    for (const char *s = "-+/*%=.,;!<>()[]{}"; *s; s++)
+      bits[(unsigned char)*s] |= ClassOperator;
+  }
+};
+
+static constexpr CharClassTable charClass;
+
+static inline bool IsClass(char c, int classes)
+{
+  return (charClass.bits[(unsigned char)c] & classes) != 0;
+}
+
+
+/* Run skipping
+ * ------------
+ * Each character class below has a scalar test, Is, and on x86-64 a
+ * vector one, Match, that sets every byte of the result whose input
+ * byte is in the class. SkipWhile and SkipUntil return the first
+ * character at or after p (and before end) that is outside, or inside,
+ * the class, or end if there is none. Blocks are only loaded while all
+ * 16 bytes are before end, so nothing past the text is read.
+ */
+#if defined(__x86_64__)
+#include <emmintrin.h>
+
+// Bytes of b between lo and hi inclusive, as unsigned values
+static inline __m128i InRange(__m128i b, char lo, char hi)
+{
+  __m128i offset = _mm_sub_epi8(b, _mm_set1_epi8(lo));
+  return _mm_cmpeq_epi8(_mm_min_epu8(offset, _mm_set1_epi8(hi - lo)), offset);
+}
+
+static inline __m128i Equal(__m128i b, char c)
+{
+  return _mm_cmpeq_epi8(b, _mm_set1_epi8(c));
+}
+#endif
+
+struct IdentChars {   // [a-zA-Z_0-9]
+  static bool Is(char c)
+      { return IsClass(c, ClassLetter | ClassDigit | ClassUnderscore); }
+#if defined(__x86_64__)
+  static __m128i Match(__m128i b)
+      { __m128i lower = _mm_or_si128(b, _mm_set1_epi8(0x20));
+        return _mm_or_si128(_mm_or_si128(InRange(lower, 'a', 'z'),
+                                         InRange(b, '0', '9')),
+                            Equal(b, '_')); }
+#endif
+};
+
+struct Digits {       // [0-9]
+  static bool Is(char c) { return IsClass(c, ClassDigit); }
+#if defined(__x86_64__)
+  static __m128i Match(__m128i b) { return InRange(b, '0', '9'); }
+#endif
+};
+
+struct Blanks {       // [ \n]
+  static bool Is(char c) { return IsClass(c, ClassBlank); }
+#if defined(__x86_64__)
+  static __m128i Match(__m128i b)
+      { return _mm_or_si128(Equal(b, ' '), Equal(b, '\n')); }
+#endif
+};
+
+struct CommentStops { // what ends a run of block comment text: * and tab
+  static bool Is(char c) { return c == '*' || c == '\t'; }
+#if defined(__x86_64__)
+  static __m128i Match(__m128i b)
+      { return _mm_or_si128(Equal(b, '*'), Equal(b, '\t')); }
+#endif
+};
+
+struct StringStops {  // what ends the body of a string: " and newline
+  static bool Is(char c) { return c == '"' || c == '\n'; }
+#if defined(__x86_64__)
+  static __m128i Match(__m128i b)
+      { return _mm_or_si128(Equal(b, '"'), Equal(b, '\n')); }
+#endif
+};
+
+template<class Class> static inline char *SkipWhile(char *p, char *end)
+{
+#if defined(__x86_64__)
+  for (; p + 16 <= end; p += 16) {
+    __m128i block = _mm_loadu_si128((const __m128i *)p);
+    uint32_t outside = ~_mm_movemask_epi8(Class::Match(block)) & 0xFFFF;
+    if (outside != 0) return p + __builtin_ctz(outside);
+  }
+#endif
+  while (p < end && Class::Is(*p)) p++;
+  return p;
+}
+
+template<class Class> static inline char *SkipUntil(char *p, char *end)
+{
+#if defined(__x86_64__)
+  for (; p + 16 <= end; p += 16) {
+    __m128i block = _mm_loadu_si128((const __m128i *)p);
+    uint32_t inside = _mm_movemask_epi8(Class::Match(block));
+    if (inside != 0) return p + __builtin_ctz(inside);
+  }
+#endif
+  while (p < end && !Class::Is(*p)) p++;
+  return p;
+}
+
+#endif
@@ -0,0 +1,35 @@
+/* File: context.cc
+ * ----------------
+ * Implementation of the compilation context.
+ */
+
+#include "context.h"
+#include "parser.h"
+#include "scanner.h"
+#include "utility.h"
+
+CompileContext::CompileContext(Scanner *s)
+{
+  scanner = s;
+  tokenSource = NULL;
+  program = NULL;
+  numErrors = 0;
+  parserCounts = IsDebugOn("reductions") ? NewParserCounts() : NULL;
+  SetScannerContext(scanner, this);
+}
+
+CompileContext::~CompileContext()
+{
+  CloseScanner(scanner);
+  DeleteParserCounts(parserCounts);
+}
+
+int CompileContext::Parse()
+{
+  return yyparse(this);
+}
+
+SourceBuffer *CompileContext::GetSource()
+{
+  return GetScannerSource(scanner);
+}
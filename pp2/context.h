@@ -0,0 +1,79 @@
+/* File: context.h
+ * ---------------
+ * This file defines the compilation context: everything about compiling
+ * one input that used to be kept in globals. The parser is pure (see
+ * parser.y) and is handed a context, from which it reads its tokens and
+ * to which it hands the tree it builds. A context owns the scanner for
+ * its input, and counts the errors reported about that input, by the
+ * scanner or the parser (see errors.h).
+ *
+ * Any number of contexts can exist at once, and parses can run on
+ * different threads at the same time, as scanners can (see scanner.h),
+ * so long as each context is used by one thread at a time. The parser's
+ * counts are kept in the context too. The other debugging reports
+ * (timing, tracing and the allocation census) are still kept for the
+ * whole process, so leave those keys off when parsing on several
+ * threads. The built-in types (Type::intType and the rest, see
+ * ast_type.h) are shared by all the trees, which only read them.
+ */
+
+#ifndef _H_context
+#define _H_context
+
+#include <stddef.h>
+
+struct Scanner;
+class TokenBuffer;
+class Program;
+class SourceBuffer;
+struct ParserCounts;
+
+class CompileContext
+{
+ public:
+  // A context for compiling what s reads. The context closes s when it
+  // is deleted, which frees the source too if s owns it (see
+  // OpenScanner), so the tree must not be used after that.
+  CompileContext(Scanner *s);
+  ~CompileContext();
+
+  // Has the parser read its tokens from tokens, which stays the
+  // caller's, rather than from the scanner (see tokenbuf.h)
+  void SetTokenSource(TokenBuffer *tokens) { tokenSource = tokens; }
+
+  // Parses the whole input and returns yyparse's result: 0 if it was
+  // accepted, in which case GetProgram has the tree. InitParser must
+  // have been called before the first parse.
+  int Parse();
+
+  Scanner *GetScanner()          { return scanner; }
+  TokenBuffer *GetTokenSource()  { return tokenSource; }
+
+  // The input, which locations are looked up in (see location.h)
+  SourceBuffer *GetSource();
+
+  // The root of the tree, once the parser has built it, or NULL. The
+  // tree points into the source: its string constants are spans of it
+  // (see TextSpan in location.h), and it is where the printer finds
+  // line numbers. So the tree is only good while the context is.
+  Program *GetProgram()          { return program; }
+  void SetProgram(Program *p)    { program = p; }
+
+  // Number of errors reported about the input so far. ReportError
+  // counts each one with CountError.
+  int NumErrors()                { return numErrors; }
+  void CountError()              { numErrors++; }
+
+  // The parser's counts of reductions and shifts (see parser.y), or
+  // NULL if the "reductions" debug key was off when the context was made
+  ParserCounts *GetParserCounts() { return parserCounts; }
+
+ private:
+  Scanner *scanner;
+  TokenBuffer *tokenSource;
+  Program *program;
+  int numErrors;
+  ParserCounts *parserCounts;
+};
+
+#endif
@@ -8,80 +8,115 @@
 #include <sstream>
 #include <stdarg.h>
 #include <stdio.h>
+#include <mutex>
 using namespace std;
 
-#include "scanner.h" // for GetLineNumbered
+#include "scanner.h" // for GetScannerSource
+#include "sourcebuf.h"
+#include "context.h"
+#include "tracing.h"
 
-int ReportError::numErrors = 0;
+// Scanners on other threads (see scanner.h) may report errors too; one
+// error is written at a time, so their lines don't interleave
+static mutex outputLock;
 
-void ReportError::UnderlineErrorInLine(const char *line, yyltype *pos) {
+void ReportError::UnderlineErrorInLine(const char *line, int length, Position *pos) {
     if (!line) return;
-    cerr << line << endl;
-    for (int i = 1; i <= pos->last_column; i++)
-        cerr << (i >= pos->first_column ? '^' : ' ');
+    cerr.write(line, length) << endl;
+    for (int i = 1; i <= pos->lastColumn; i++)
+        cerr << (i >= pos->firstColumn ? '^' : ' ');
     cerr << endl;
 }
 
  
  
-void ReportError::OutputError(yyltype *loc, string msg) {
-    numErrors++;
-    fflush(stdout); // make sure any buffered text has been output
+void ReportError::OutputError(Scanner *scanner, yyltype *loc, string msg) {
     if (loc) {
-        cerr << endl << "*** Error line " << loc->first_line << "." << endl;
-        UnderlineErrorInLine(GetLineNumbered(loc->first_line), loc);
+        Position pos = GetPosition(GetScannerSource(scanner), loc);
+        OutputErrorAt(scanner, &pos, msg);
+    } else
+        OutputErrorAt(scanner, NULL, msg);
+}
+
+/* The error counts against the scanner's context, which only the thread
+ * using it touches; the lock is just for the output.
+ */
+void ReportError::OutputErrorAt(Scanner *scanner, Position *pos, string msg) {
+    CompileContext *context = GetScannerContext(scanner);
+    if (context) context->CountError();
+    lock_guard<mutex> guard(outputLock);
+    fflush(stdout); // make sure any buffered text has been output
+    if (pos) {
+        cerr << endl << "*** Error line " << pos->line << "." << endl;
+        int length;
+        const char *line = GetScannerSource(scanner)->GetLine(pos->line, &length);
+        UnderlineErrorInLine(line, length, pos);
     } else
         cerr << endl << "*** Error." << endl;
     cerr << "*** " << msg << endl << endl;
+    Trace::Instant("error", "error", pos ? pos->line : 0, msg.c_str());
 }
 
 
-void ReportError::Formatted(yyltype *loc, const char *format, ...) {
+void ReportError::Formatted(Scanner *scanner, yyltype *loc, const char *format, ...) {
     va_list args;
     char errbuf[2048];
     
     va_start(args, format);
     vsprintf(errbuf,format, args);
     va_end(args);
-    OutputError(loc, errbuf);
+    OutputError(scanner, loc, errbuf);
 }
 
-void ReportError::UntermComment() {
-    OutputError(NULL, "Input ends with unterminated comment");
+void ReportError::UntermComment(Scanner *scanner) {
+    OutputError(scanner, NULL, "Input ends with unterminated comment");
 }
 
-void ReportError::InvalidDirective(int linenum) {
-    yyltype ll = {0, linenum, 0, 0};
-    OutputError(&ll, "Invalid # directive");
+void ReportError::InvalidDirective(Scanner *scanner, int linenum) {
+    Position pos = {linenum, 0, 0};
+    OutputErrorAt(scanner, &pos, "Invalid # directive");
 }
 
-void ReportError::LongIdentifier(yyltype *loc, const char *ident) {
+void ReportError::LongIdentifier(Scanner *scanner, yyltype *loc, const char *ident) {
     stringstream s;
     s << "Identifier too long: \"" << ident << "\"";
-    OutputError(loc, s.str());
+    OutputError(scanner, loc, s.str());
 }
 
-void ReportError::UntermString(yyltype *loc, const char *str) {
+void ReportError::UntermString(Scanner *scanner, yyltype *loc, const char *str) {
     stringstream s;
     s << "Unterminated string constant: " << str;
-    OutputError(loc, s.str());
+    OutputError(scanner, loc, s.str());
 }
 
-void ReportError::UnrecogChar(yyltype *loc, char ch) {
+void ReportError::UnrecogChar(Scanner *scanner, yyltype *loc, char ch) {
     stringstream s;
     s << "Unrecognized char: '" << ch << "'" ;
-    OutputError(loc, s.str());
+    OutputError(scanner, loc, s.str());
+}
+
+void ReportError::IntegerOutOfRange(Scanner *scanner, yyltype *loc, const char *text) {
+    stringstream s;
+    s << "Integer constant out of range: " << text;
+    OutputError(scanner, loc, s.str());
+}
+
+void ReportError::DoubleOutOfRange(Scanner *scanner, yyltype *loc, const char *text) {
+    stringstream s;
+    s << "Double constant out of range: " << text;
+    OutputError(scanner, loc, s.str());
 }
   
 /* Function: yyerror()
  * -------------------
  * Standard error-reporting function expected by yacc. Our version merely
  * just calls into the error reporter above, passing the location of
- * the last token read. If you want to suppress the ordinary "parse error"
- * message from yacc, you can implement yyerror to do nothing and
- * then call ReportError::Formatted yourself with a more descriptive 
- * message.
+ * the last token read and the scanner of the context being parsed (the
+ * parser is pure, see parser.y, so it hands us both). If you want to
+ * suppress the ordinary "parse error" message from yacc, you can
+ * implement yyerror to do nothing and then call ReportError::Formatted
+ * yourself with a more descriptive message.
  */
-void yyerror(const char *msg) {
-    ReportError::Formatted(&yylloc, "%s", msg);
+void yyerror(yyltype *loc, CompileContext *context, const char *msg) {
+    ReportError::Formatted(context->GetScanner(), loc, "%s", msg);
 }
@@ -16,6 +16,8 @@
 using std::string;
 #include "location.h"
 
+struct Scanner;
+
 /* General notes on using this class
  * ----------------------------------
  * Each of the methods in thie class matches one of the standard Decaf
@@ -25,9 +27,12 @@ using std::string;
  * on this class are static, thus you can invoke methods directly via
  * the class name, e.g.
  *
- *    if (missingEnd) ReportError::UntermString(&yylloc, str);
+ *    if (missingEnd) ReportError::UntermString(scanner, loc, str);
  *
- * For some methods, the first argument is the pointer to the location
+ * The first argument is the scanner whose input the problem is in. The
+ * message quotes the offending line from that input, and the error is
+ * counted by the scanner's CompileContext (see context.h), if it has
+ * one. For some methods, the next argument is the pointer to the location
  * structure that identifies where the problem is (usually this is the
  * location of the offending token). You can pass NULL for the argument
  * if there is no appropriate position to point out. For other methods,
@@ -43,27 +48,27 @@ class ReportError
  public:
 
   // Errors used by preprocessor
-  static void UntermComment();
-  static void InvalidDirective(int linenum);
+  static void UntermComment(Scanner *scanner);
+  static void InvalidDirective(Scanner *scanner, int linenum);
 
 
   // Errors used by scanner
-  static void LongIdentifier(yyltype *loc, const char *ident);
-  static void UntermString(yyltype *loc, const char *str);
-  static void UnrecogChar(yyltype *loc, char ch);
+  static void LongIdentifier(Scanner *scanner, yyltype *loc, const char *ident);
+  static void UntermString(Scanner *scanner, yyltype *loc, const char *str);
+  static void UnrecogChar(Scanner *scanner, yyltype *loc, char ch);
+  static void IntegerOutOfRange(Scanner *scanner, yyltype *loc, const char *text);
+  static void DoubleOutOfRange(Scanner *scanner, yyltype *loc, const char *text);
 
   // Generic method to report a printf-style error message
-  static void Formatted(yyltype *loc, const char *format, ...);
-
+  static void Formatted(Scanner *scanner, yyltype *loc, const char *format, ...);
 
-  // Returns number of error messages printed
-  static int NumErrors() { return numErrors; }
+  // The number of errors is kept by the CompileContext, see context.h
   
  private:
 
-  static void UnderlineErrorInLine(const char *line, yyltype *pos);
-  static void OutputError(yyltype *loc, string msg);
-  static int numErrors;
+  static void UnderlineErrorInLine(const char *line, int length, Position *pos);
+  static void OutputError(Scanner *scanner, yyltype *loc, string msg);
+  static void OutputErrorAt(Scanner *scanner, Position *pos, string msg);
   
 };
 
@@ -0,0 +1,466 @@
+/* File: handscan.cc
+ * -----------------
+ * A hand-written scanner that can replace the flex one (scanner.l).
+ * Build it with  make SCANNER=hand  (see the Makefile). It recognizes
+ * exactly the same tokens, reports the same errors and fills in token
+ * values and locations the same way, so the parser and the rest of the compiler
+ * can't tell which one they were linked with; the lexdiff target runs
+ * both over the samples and compares their token dumps and output.
+ *
+ * It scans the same source buffer (sourcebuf.h), with the same line
+ * table, and uses the same keyword table (keywords.h) and identifier
+ * table (intern.h). What it does differently is how it finds the end of
+ * a token: the first character picks the kind of token from a table,
+ * and the runs that make up most of the text (the rest of an identifier,
+ * digits, blanks and newlines, the body of a comment or string) are
+ * skipped 16 bytes at a time with SSE2, which classifies every byte of a
+ * block with a few compares and finds the first one outside the run from
+ * the resulting bit mask. On other machines, and for the last few bytes
+ * of the text, the runs are skipped a byte at a time with the table.
+ * (The classes and the skipping are in charscan.h, which scanner.l uses
+ * too.)
+ *
+ * The longest-match rules of scanner.l are written out by hand:
+ *
+ *   - 0x or 0X starts a hex constant only if a hex digit follows and
+ *     the 0 is the whole digit run, so 00x1 is 00 followed by x1,
+ *   - a digit run followed by a dot is a double, with an exponent only
+ *     if digits follow the E (and its sign), so 1.5e is 1.5 then e,
+ *   - a string that reaches a newline or the end of the text is an
+ *     unterminated string, reported and skipped,
+ *   - [] is one token (T_Dims) rather than two,
+ *   - anything else, including a lone & or |, is an unrecognized
+ *     character.
+ *
+ * Columns are kept exactly as DoBeforeEachAction and the tab rule in
+ * scanner.l keep them. The one liberty taken is inside block comments,
+ * where flex matches one character at a time: here the text between
+ * tabs is taken as one match, which moves the column by the same amount
+ * (tabs still move it to the next tab stop). So the rule histogram of
+ * this scanner counts comment text in runs, not characters.
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <errno.h>
+#include "scanner.h"
+#include "utility.h" // for PrintDebug()
+#include "errors.h"
+#include "parser.h" // for token codes, YYSTYPE
+#include "sourcebuf.h"
+#include "intern.h"
+#include "keywords.h"
+#include "literals.h"
+#include "charscan.h"
+
+#define TAB_SIZE SourceBuffer::TabSize
+
+/* Rule histogram
+ * --------------
+ * The rules here are the rules of scanner.l, named rather than numbered
+ * (flex's numbers depend on the order of scanner.l). Keywords are
+ * counted with identifiers, as they are in scanner.l.
+ */
+typedef enum { RuleBlanks, RuleTab, RuleBeginComment, RuleEndComment,
+               RuleCommentText, RuleLineComment, RuleOperator2,
+               RuleOperator, RuleDims, RuleInteger, RuleHexInteger,
+               RuleDouble, RuleString, RuleUntermString, RuleIdentifier,
+               RuleDefault, NumRules } ruleT;
+
+static const char *ruleNames[NumRules] = {
+  "blanks", "tab", "begin comment", "end comment", "comment text",
+  "line comment", "operator (2)", "operator", "dims", "integer",
+  "hex integer", "double", "string", "unterm string", "identifier",
+  "default"
+};
+
+static const int SampleLen = 20;
+
+
+/* Scanner state
+ * -------------
+ * Everything kept between calls to ScanToken, as in scanner.l: any
+ * number of scanners can be open at once (see scanner.h).
+ */
+struct Scanner {
+    SourceBuffer *source;
+    bool ownsSource;          // whether closing the scanner deletes it
+    CompileContext *context;  // the one it belongs to, or NULL
+    char *cur, *textEnd;      // next character to scan, end of the text
+    bool inComment;           // inside a block comment (flex's COMM state)
+    char *text;               // the current token, NUL-terminated
+    char *holdPos;            // where a NUL was put to end text
+    char holdChar;            // and the character it replaced
+    int curLineNum, curColNum;
+    size_t nextLineStart;     // offset where line curLineNum+1 begins
+    size_t tokenStart;        // offset of the last match
+    yyltype *loc;             // where ScanToken puts token locations
+    int ruleMatches[NumRules];
+    char ruleSample[NumRules][SampleLen+1];
+};
+
+
+static inline void ReleaseText(Scanner *s);
+
+/* Function: OpenScanner
+ * ---------------------
+ * Reads the input from filename, or stdin if it is NULL, into a
+ * SourceBuffer, as the flex scanner's OpenScanner does, and starts
+ * scanning at its beginning. Returns NULL, with errno set, if the input
+ * can't be read.
+ */
+Scanner *OpenScanner(const char *filename)
+{
+    SourceBuffer *source = SourceBuffer::Open(filename);
+    if (source == NULL) return NULL;
+
+    Scanner *s = OpenScanner(source, 0, 1, 1);
+    s->ownsSource = true;
+    return s;
+}
+
+// Starts at offset in source, which the scanner doesn't own (see scanner.h)
+Scanner *OpenScanner(SourceBuffer *source, size_t offset, int line,
+                     int column)
+{
+    Scanner *s = new Scanner();
+    s->source = source;
+    s->ownsSource = false;
+    s->cur = source->GetScanText() + offset;
+    s->textEnd = source->GetScanText() + source->GetLength();
+    s->curLineNum = line;
+    s->curColNum = column;
+    s->nextLineStart = source->GetLineStart(s->curLineNum + 1);
+    return s;
+}
+
+void CloseScanner(Scanner *s)
+{
+    ReleaseText(s);
+    if (s->ownsSource) delete s->source;
+    delete s;
+}
+
+size_t GetTokenStart(Scanner *s)
+{
+    return s->tokenStart;
+}
+
+SourceBuffer *GetScannerSource(Scanner *s)
+{
+    return s->source;
+}
+
+void SetScannerContext(Scanner *s, CompileContext *context)
+{
+    s->context = context;
+}
+
+CompileContext *GetScannerContext(Scanner *s)
+{
+    return s->context;
+}
+
+
+/* Function: Match()
+ * -----------------
+ * Does for each match what DoBeforeEachAction does in scanner.l: counts
+ * it in the rule histogram, records its location and moves the column
+ * along, first moving to the line the match starts on if it is past the
+ * start of the next one (or, with compact locations, just records its
+ * offset and length). The match is the len characters at start, and
+ * s->cur is moved past it.
+ */
+static inline void Match(Scanner *s, ruleT rule, char *start, int len)
+{
+    if (s->ruleMatches[rule]++ == 0) {
+        int n = len < SampleLen ? len : SampleLen;
+        memcpy(s->ruleSample[rule], start, n);
+        s->ruleSample[rule][n] = '\0';
+    }
+    size_t offset = start - s->source->GetScanText();
+    s->tokenStart = offset;
+#ifdef COMPACT_LOCATIONS
+    s->loc->offset = offset;
+    s->loc->length = len;
+#else
+    if (offset >= s->nextLineStart) {
+        do
+            s->nextLineStart = s->source->GetLineStart(++s->curLineNum + 1);
+        while (offset >= s->nextLineStart);
+        s->curColNum = 1 + offset - s->source->GetLineStart(s->curLineNum);
+    }
+    s->loc->first_line = s->curLineNum;
+    s->loc->first_column = s->curColNum;
+    s->loc->last_column = s->curColNum + len - 1;
+    s->curColNum += len;
+#endif
+    s->cur = start + len;
+}
+
+/* Sets the token text to the match, ending it with a NUL as flex does
+ * for yytext; the character the NUL replaced is put back by
+ * ReleaseText, which ScanToken calls on its way in.
+ */
+static inline void SetText(Scanner *s, char *start, int len)
+{
+    s->text = start;
+    s->holdPos = start + len;
+    s->holdChar = *s->holdPos;
+    *s->holdPos = '\0';
+}
+
+static inline void ReleaseText(Scanner *s)
+{
+    if (s->holdPos) {
+        *s->holdPos = s->holdChar;
+        s->holdPos = NULL;
+    }
+}
+
+// A match's text in the source buffer's own copy, as in scanner.l
+static inline TextSpan SpanOf(Scanner *s, const char *start, int len)
+{
+    TextSpan span = { s->source->GetText() + (start - s->source->GetScanText()),
+                      len };
+    return span;
+}
+
+// The tab rule, which also runs inside comments
+static inline void MatchTab(Scanner *s, char *p)
+{
+    Match(s, RuleTab, p, 1);
+#ifndef COMPACT_LOCATIONS
+    s->curColNum += TAB_SIZE - s->curColNum%TAB_SIZE + 1;
+#endif
+}
+
+
+/* Function: SkipComment()
+ * -----------------------
+ * Scans the rest of a block comment, from s->cur. Returns false if the
+ * text ends first, having reported the unterminated comment.
+ */
+static bool SkipComment(Scanner *s)
+{
+    for (;;) {
+        char *p = SkipUntil<CommentStops>(s->cur, s->textEnd);
+        if (p == s->textEnd && p - s->cur > 1) {
+            // A syntax error at the end of the input is reported at the
+            // last match, which for flex is the comment's last character
+            Match(s, RuleCommentText, s->cur, p - 1 - s->cur);
+            Match(s, RuleCommentText, p - 1, 1);
+        } else if (p > s->cur) {
+            Match(s, RuleCommentText, s->cur, p - s->cur);
+        }
+        if (p == s->textEnd) {
+            ReportError::UntermComment(s);
+            return false;
+        }
+        if (*p == '\t') {
+            MatchTab(s, p);
+        } else if (p + 1 < s->textEnd && p[1] == '/') {
+            Match(s, RuleEndComment, p, 2);
+            s->inComment = false;
+            return true;
+        } else {
+            Match(s, RuleCommentText, p, 1);
+        }
+    }
+}
+
+
+/* Function: ScanNumber()
+ * ----------------------
+ * Scans an integer, hex integer or double constant starting at p, which
+ * is a digit, and returns its token.
+ */
+static int ScanNumber(Scanner *s, char *p, YYSTYPE *value)
+{
+    char *end = s->textEnd;
+    char *q = SkipWhile<Digits>(p + 1, end);
+    if (q == p + 1 && *p == '0' && q + 1 < end && (*q == 'x' || *q == 'X')
+        && IsClass(q[1], ClassHexDigit)) {
+        q = q + 2;
+        while (q < end && IsClass(*q, ClassHexDigit)) q++;
+        Match(s, RuleHexInteger, p, q - p);
+        value->integerConstant = ConvertHexInteger(s, p, q - p, s->loc);
+        return T_IntConstant;
+    }
+    if (q < end && *q == '.') {
+        q = SkipWhile<Digits>(q + 1, end);
+        if (q < end && (*q == 'E' || *q == 'e')) {
+            char *e = q + 1;
+            if (e < end && (*e == '+' || *e == '-')) e++;
+            if (e < end && IsClass(*e, ClassDigit))
+                q = SkipWhile<Digits>(e + 1, end);
+        }
+        Match(s, RuleDouble, p, q - p);
+        value->doubleConstant = ConvertDouble(s, p, q - p, s->loc);
+        return T_DoubleConstant;
+    }
+    Match(s, RuleInteger, p, q - p);
+    value->integerConstant = ConvertInteger(s, p, q - p, s->loc);
+    return T_IntConstant;
+}
+
+
+/* Function: ScanOperator()
+ * ------------------------
+ * Returns the token for the two-character operator starting at p, or 0
+ * if there isn't one.
+ */
+static inline int ScanOperator(char *p, char *end)
+{
+    if (p + 1 >= end) return 0;
+    switch (p[0]) {
+      case '+': return p[1] == '+' ? T_PostIncrement : 0;
+      case '-': return p[1] == '-' ? T_PostDecrement : 0;
+      case '<': return p[1] == '=' ? T_LessEqual : 0;
+      case '>': return p[1] == '=' ? T_GreaterEqual : 0;
+      case '=': return p[1] == '=' ? T_Equal : 0;
+      case '!': return p[1] == '=' ? T_NotEqual : 0;
+      case '&': return p[1] == '&' ? T_And : 0;
+      case '|': return p[1] == '|' ? T_Or : 0;
+      case '[': return p[1] == ']' ? T_Dims : 0;
+    }
+    return 0;
+}
+
+
+/* Function: ScanToken()
+ * ---------------------
+ * Returns the next token from s, with its value in *value and its
+ * location in *loc, or 0 at the end of the input. Errors are reported
+ * and scanning goes on, as in scanner.l.
+ */
+int ScanToken(Scanner *s, YYSTYPE *value, yyltype *loc)
+{
+    s->loc = loc;
+    ReleaseText(s);
+    if (s->inComment && !SkipComment(s)) return 0;
+
+    char *end = s->textEnd;
+    for (;;) {
+        char *p = s->cur;
+        if (p >= end) return 0;
+        char c = *p;
+
+        if (IsClass(c, ClassLetter)) {
+            char *q = SkipWhile<IdentChars>(p + 1, end);
+            int len = q - p;
+            Match(s, RuleIdentifier, p, len);
+            int keyword = LookupKeyword(p, len);
+            if (keyword == T_BoolConstant)
+                value->boolConstant = (c == 't');
+            SetText(s, p, len);
+            if (keyword)
+                return keyword;
+            if (len > MaxIdentLen)
+                ReportError::LongIdentifier(s, loc, s->text);
+            value->identifier = InternTable::Intern(p,
+                                   len > MaxIdentLen ? MaxIdentLen : len);
+            return T_Identifier;
+        }
+        if (IsClass(c, ClassBlank)) {
+            Match(s, RuleBlanks, p, SkipWhile<Blanks>(p + 1, end) - p);
+            continue;
+        }
+        if (IsClass(c, ClassDigit))
+            return ScanNumber(s, p, value);
+
+        if (c == '/' && p + 1 < end && (p[1] == '*' || p[1] == '/')) {
+            if (p[1] == '/') {
+                char *q = (char *)memchr(p + 2, '\n', end - (p + 2));
+                Match(s, RuleLineComment, p, (q ? q : end) - p);
+                continue;
+            }
+            Match(s, RuleBeginComment, p, 2);
+            s->inComment = true;
+            if (!SkipComment(s)) return 0;
+            continue;
+        }
+        int token = ScanOperator(p, end);
+        if (token) {
+            Match(s, token == T_Dims ? RuleDims : RuleOperator2, p, 2);
+            SetText(s, p, 2);
+            return token;
+        }
+        if (IsClass(c, ClassOperator)) {
+            Match(s, RuleOperator, p, 1);
+            SetText(s, p, 1);
+            return c;
+        }
+        if (c == '"') {
+            char *q = SkipUntil<StringStops>(p + 1, end);
+            if (q < end && *q == '"') {
+                Match(s, RuleString, p, q + 1 - p);
+                value->stringConstant = SpanOf(s, p, q + 1 - p);
+                return T_StringConstant;
+            }
+            Match(s, RuleUntermString, p, q - p);
+            SetText(s, p, q - p);
+            ReportError::UntermString(s, loc, s->text);
+            ReleaseText(s);
+            continue;
+        }
+        if (c == '\t') {
+            MatchTab(s, p);
+            continue;
+        }
+        Match(s, RuleDefault, p, 1);
+        ReportError::UnrecogChar(s, loc, c);
+    }
+}
+
+
+/* Function: InitScanner
+ * ---------------------
+ * Opens the scanner for the compile, on filename or stdin, and returns
+ * it (to be handed to a CompileContext), or quits if the input can't be
+ * read.
+ */
+Scanner *InitScanner(const char *filename)
+{
+    PrintDebug("lex", "Initializing scanner");
+    Scanner *s = OpenScanner(filename);
+    if (s == NULL) {
+        fprintf(stderr, "dcc: cannot read %s: %s\n",
+                filename ? filename : "stdin", strerror(errno));
+        exit(2);
+    }
+    return s;
+}
+
+
+/* Function: PrintRuleHistogram()
+ * ------------------------------
+ * Prints how many times each rule matched, most frequent first, to
+ * stderr, in the same form as the flex scanner's histogram.
+ */
+void PrintRuleHistogram(Scanner *s)
+{
+    int order[NumRules], n = 0;
+    long total = 0;
+    for (int r = 0; r < NumRules; r++)
+        if (s->ruleMatches[r] > 0) {
+            int i = n++;
+            for (; i > 0 && s->ruleMatches[order[i-1]] < s->ruleMatches[r]; i--)
+                order[i] = order[i-1];
+            order[i] = r;
+            total += s->ruleMatches[r];
+        }
+
+    fprintf(stderr, "\n%-14s %10s %7s  %s\n", "rule", "matches", "%", "sample");
+    for (int i = 0; i < n; i++) {
+        int r = order[i];
+        fprintf(stderr, "%-14s %10d %6.1f%%  \"", ruleNames[r], s->ruleMatches[r],
+                100.0 * s->ruleMatches[r] / total);
+        for (const char *c = s->ruleSample[r]; *c; c++)
+            if (*c == '\n') fputs("\\n", stderr);
+            else if (*c == '\t') fputs("\\t", stderr);
+            else fputc(*c, stderr);
+        fprintf(stderr, "\"\n");
+    }
+    fprintf(stderr, "%-14s %10ld\n", "total", total);
+}
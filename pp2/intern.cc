@@ -0,0 +1,173 @@
+/* File: intern.cc
+ * ---------------
+ * Implementation of the identifier intern table.
+ *
+ * Reads don't take the lock. A symbol's entry is written once, before
+ * its number is published, into a block that never moves, so GetName
+ * and GetLength just index the blocks. Intern first probes the current
+ * hash table the same way, which finds any name seen before; only a
+ * miss takes the lock, probes again and adds the name. Growing the hash
+ * table builds a new one and publishes it whole, and the old one is
+ * kept (like the names, never freed) for lookups that may still be
+ * probing it. A lookup there can only miss names added since, and a
+ * miss is settled under the lock.
+ */
+
+#include "intern.h"
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <mutex>
+#include "memstats.h"
+#include "utility.h"
+
+static AllocBucket nameChunks("interned names", MemStrings);
+static AllocBucket symbolBlocks("intern symbols", MemStrings);
+static AllocBucket hashSlots("intern hash table", MemStrings);
+
+struct Symbol {
+  const char *name;
+  int length;
+  uint32_t hash;
+};
+
+static const int ChunkSize = 64 * 1024;
+static char *chunk = NULL;     // where the next name is stored
+static int chunkLeft = 0;      // bytes left in the current chunk
+
+// Symbol n is entry n % BlockSize of block n / BlockSize
+static const int BlockBits = 12;
+static const int BlockSize = 1 << BlockBits;
+static const int MaxBlocks = 1 << 16;
+static std::atomic<Symbol *> blocks[MaxBlocks];
+static std::atomic<int> numSymbols(0);
+
+struct HashTable {
+  unsigned mask;              // size - 1, a power of 2 less one
+  std::atomic<int> *slots;    // symbol numbers, -1 for an empty slot
+};
+static std::atomic<HashTable *> table(NULL);
+
+// Taken only to add a name: guards the chunks, new blocks and growing
+static std::mutex tableLock;
+
+
+// FNV-1a; identifiers are short, so this is about as fast as anything
+static uint32_t Hash(const char *text, int length)
+{
+  uint32_t h = 2166136261u;
+  for (int i = 0; i < length; i++)
+    h = (h ^ (unsigned char)text[i]) * 16777619u;
+  return h;
+}
+
+static const Symbol &Entry(int symbol)
+{
+  return blocks[symbol >> BlockBits].load(std::memory_order_acquire)
+      [symbol & (BlockSize - 1)];
+}
+
+// Returns the symbol for text in t, or -1 if it isn't there, setting
+// *end to the empty slot the probe stopped at
+static int Find(const HashTable *t, const char *text, int length,
+                uint32_t hash, unsigned *end)
+{
+  unsigned i = hash & t->mask;
+  for (int s; (s = t->slots[i].load(std::memory_order_acquire)) != -1;
+       i = (i + 1) & t->mask) {
+    const Symbol &sym = Entry(s);
+    if (sym.hash == hash && sym.length == length &&
+        memcmp(sym.name, text, length) == 0)
+      return s;
+  }
+  *end = i;
+  return -1;
+}
+
+static const char *Store(const char *text, int length)
+{
+  if (length + 1 > chunkLeft) {
+    int size = (length + 1 > ChunkSize ? length + 1 : ChunkSize);
+    chunk = (char *)malloc(size);
+    chunkLeft = size;
+    if (MemStats::IsOn()) MemStats::Allocated(&nameChunks, size);
+  }
+  char *name = chunk;
+  memcpy(name, text, length);
+  name[length] = '\0';
+  chunk += length + 1;
+  chunkLeft -= length + 1;
+  return name;
+}
+
+// Replaces the table with one twice the size (or creates it), keeping it
+// at most half full. Called with the lock held.
+static HashTable *Grow(HashTable *old, int count)
+{
+  HashTable *t = new HashTable;
+  size_t size = (old ? ((size_t)old->mask + 1) * 2 : 1024);
+  if (MemStats::IsOn())
+    MemStats::Allocated(&hashSlots, size * sizeof(int), old == NULL);
+  t->slots = new std::atomic<int>[size];
+  t->mask = size - 1;
+  for (size_t i = 0; i < size; i++)
+    t->slots[i].store(-1, std::memory_order_relaxed);
+  for (int s = 0; s < count; s++) {
+    unsigned i = Entry(s).hash & t->mask;
+    while (t->slots[i].load(std::memory_order_relaxed) != -1)
+      i = (i + 1) & t->mask;
+    t->slots[i].store(s, std::memory_order_relaxed);
+  }
+  table.store(t, std::memory_order_release);
+  return t;
+}
+
+int InternTable::Intern(const char *text, int length)
+{
+  uint32_t hash = Hash(text, length);
+  unsigned end;
+  HashTable *t = table.load(std::memory_order_acquire);
+  int s = (t ? Find(t, text, length, hash, &end) : -1);
+  if (s != -1) return s;
+
+  std::lock_guard<std::mutex> guard(tableLock);
+  int count = numSymbols.load(std::memory_order_relaxed);
+  t = table.load(std::memory_order_relaxed);
+  if (t == NULL || 2 * ((size_t)count + 1) > (size_t)t->mask + 1)
+    t = Grow(t, count);
+  if ((s = Find(t, text, length, hash, &end)) != -1) return s;
+
+  Assert(count < MaxBlocks * BlockSize);
+  Symbol *block = blocks[count >> BlockBits].load(std::memory_order_relaxed);
+  if (block == NULL) {
+    block = (Symbol *)malloc(BlockSize * sizeof(Symbol));
+    if (MemStats::IsOn())
+      MemStats::Allocated(&symbolBlocks, BlockSize * sizeof(Symbol));
+    blocks[count >> BlockBits].store(block, std::memory_order_release);
+  }
+  Symbol &sym = block[count & (BlockSize - 1)];
+  sym.name = Store(text, length);
+  sym.length = length;
+  sym.hash = hash;
+  numSymbols.store(count + 1, std::memory_order_release);
+  t->slots[end].store(count, std::memory_order_release);
+  return count;
+}
+
+const char *InternTable::GetName(int symbol)
+{
+  Assert(symbol >= 0 && symbol < NumSymbols());
+  return Entry(symbol).name;
+}
+
+int InternTable::GetLength(int symbol)
+{
+  Assert(symbol >= 0 && symbol < NumSymbols());
+  return Entry(symbol).length;
+}
+
+int InternTable::NumSymbols()
+{
+  return numSymbols.load(std::memory_order_acquire);
+}
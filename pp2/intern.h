@@ -0,0 +1,38 @@
+/* File: intern.h
+ * --------------
+ * This file defines the table of interned identifiers. Each distinct
+ * identifier in the program is stored once and numbered, in order of
+ * first appearance, with a small integer symbol. The scanner hands the
+ * parser the symbol (in yylval) instead of the text, Identifier nodes
+ * keep the symbol and a pointer to the one stored copy, and names can
+ * be compared by comparing their symbols.
+ *
+ * The names are kept NUL-terminated in large chunks that are never
+ * freed, so the pointers GetName returns stay valid for the whole run.
+ * Lookups go through an open-addressing hash table of symbols.
+ *
+ * There is one table for the whole process, shared by every scanner
+ * (see scanner.h), and each call is safe to make from any thread.
+ * Looking up a name already in the table, and GetName and GetLength,
+ * don't lock; only adding a new name does (see intern.cc).
+ */
+
+#ifndef _H_intern
+#define _H_intern
+
+class InternTable
+{
+ public:
+  // Returns the symbol for the length characters at text (which need
+  // not be NUL-terminated), adding the name if it is new
+  static int Intern(const char *text, int length);
+
+  // The stored name of a symbol, and its length
+  static const char *GetName(int symbol);
+  static int GetLength(int symbol);
+
+  // Number of distinct names interned so far
+  static int NumSymbols();
+};
+
+#endif
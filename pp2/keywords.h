@@ -0,0 +1,106 @@
+/* File: keywords.h
+ * ----------------
+ * This file defines how the scanner recognizes reserved words. Rather
+ * than one flex rule per keyword, the scanner matches every word with
+ * the identifier rule and then looks the word up here, which keeps the
+ * scanner's tables small.
+ *
+ * The lookup is a perfect hash: the hash of each keyword (made from its
+ * first and last characters and its length) picks a different slot of a
+ * 64-entry table, so a lookup is one hash, one slot and at most one
+ * string compare. The table is built by the compiler from the keyword
+ * list below, and a static_assert checks that no two keywords share a
+ * slot; if a new keyword collides, pick other multipliers in
+ * KeywordHash (tools/kwhash.py finds some).
+ *
+ * "true" and "false" are in the table too, as T_BoolConstant.
+ */
+
+#ifndef _H_keywords
+#define _H_keywords
+
+#include <string.h>
+#include "parser.h" // for token codes
+
+struct Keyword {
+  const char *name;
+  int length;
+  int token;
+};
+
+static const int NumKeywordSlots = 64;
+
+constexpr int KeywordLength(const char *s)
+{
+  return *s ? 1 + KeywordLength(s + 1) : 0;
+}
+
+constexpr unsigned KeywordHash(const char *s, int length)
+{
+  return ((unsigned char)s[0] + 3u * (unsigned char)s[length-1] + 30u * length)
+         & (NumKeywordSlots - 1);
+}
+
+constexpr Keyword MakeKeyword(const char *name, int token)
+{
+  return Keyword{name, KeywordLength(name), token};
+}
+
+static constexpr Keyword keywordList[] = {
+  MakeKeyword("void", T_Void),               MakeKeyword("int", T_Int),
+  MakeKeyword("double", T_Double),           MakeKeyword("bool", T_Bool),
+  MakeKeyword("string", T_String),           MakeKeyword("null", T_Null),
+  MakeKeyword("class", T_Class),             MakeKeyword("extends", T_Extends),
+  MakeKeyword("this", T_This),               MakeKeyword("interface", T_Interface),
+  MakeKeyword("implements", T_Implements),   MakeKeyword("while", T_While),
+  MakeKeyword("for", T_For),                 MakeKeyword("if", T_If),
+  MakeKeyword("else", T_Else),               MakeKeyword("return", T_Return),
+  MakeKeyword("break", T_Break),             MakeKeyword("New", T_New),
+  MakeKeyword("NewArray", T_NewArray),       MakeKeyword("Print", T_Print),
+  MakeKeyword("ReadInteger", T_ReadInteger), MakeKeyword("ReadLine", T_ReadLine),
+  MakeKeyword("true", T_BoolConstant),       MakeKeyword("false", T_BoolConstant),
+};
+static const int NumKeywords = sizeof(keywordList) / sizeof(keywordList[0]);
+
+struct KeywordTable {
+  Keyword slots[NumKeywordSlots];
+};
+
+constexpr KeywordTable MakeKeywordTable()
+{
+  KeywordTable table = {};
+  for (int i = 0; i < NumKeywords; i++) {
+    const Keyword &k = keywordList[i];
+    table.slots[KeywordHash(k.name, k.length)] = k;
+  }
+  return table;
+}
+
+constexpr bool KeywordHashIsPerfect()
+{
+  bool used[NumKeywordSlots] = {};
+  for (int i = 0; i < NumKeywords; i++) {
+    unsigned h = KeywordHash(keywordList[i].name, keywordList[i].length);
+    if (used[h]) return false;
+    used[h] = true;
+  }
+  return true;
+}
+
+static_assert(KeywordHashIsPerfect(), "two keywords hash to the same slot");
+
+static constexpr KeywordTable keywordTable = MakeKeywordTable();
+
+
+/* Function: LookupKeyword
+ * -----------------------
+ * Returns the token code of the keyword spelled by the length characters
+ * at text, or 0 if they don't spell a keyword. length must be at least 1.
+ */
+static inline int LookupKeyword(const char *text, int length)
+{
+  const Keyword &k = keywordTable.slots[KeywordHash(text, length)];
+  return (k.length == length && memcmp(k.name, text, length) == 0) ? k.token : 0;
+}
+
+#endif
@@ -3,7 +3,9 @@
  * Simple list class for storing a linear collection of elements. It
  * supports operations similar in name to the CS107 DArray -- nth, insert,
  * append, remove, etc.  This class is nothing more than a very thin
- * cover of a STL deque, with some added range-checking. Given not everyone
+ * cover of a STL deque, with some added range-checking. The deque's storage
+ * and the List objects themselves are charged to the allocation census
+ * (see memstats.h), one bucket per element type. Given not everyone
  * is familiar with the C++ templates, this class provides a more familiar
  * interface.
  *
@@ -30,18 +32,27 @@
 
 #include <deque>
 #include "utility.h"  // for Assert()
+#include "memstats.h" // for CountingAllocator
   
 class Node;
 
 template<class Element> class List {
 
  private:
-    std::deque<Element> elems;
+    std::deque<Element, CountingAllocator<Element, Element> > elems;
 
  public:
            // Create a new empty list
     List() {}
 
+           // Lists are counted by the allocation census like nodes are
+    static void *operator new(size_t size)
+        { void *list = ::operator new(size);
+          if (MemStats::IsOn()) MemStats::Allocated(ListBucket<Element>(), size);
+          return list; }
+    static void operator delete(void *list)
+        { ::operator delete(list); }
+
            // Returns count of elements currently in list
     int NumElements() const
 	{ return elems.size(); }
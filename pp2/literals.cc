@@ -0,0 +1,43 @@
+/* File: literals.cc
+ * -----------------
+ * Implementation of the numeric constant conversions.
+ */
+
+#include "literals.h"
+#include <stdint.h>
+#include <charconv>
+#include <string>
+#include "errors.h"
+
+int ConvertInteger(Scanner *s, const char *text, int length, yyltype *loc)
+{
+  uint32_t value;
+  std::from_chars_result r = std::from_chars(text, text + length, value);
+  if (r.ec != std::errc() || value > INT32_MAX) {
+    ReportError::IntegerOutOfRange(s, loc, std::string(text, length).c_str());
+    return 0;
+  }
+  return value;
+}
+
+int ConvertHexInteger(Scanner *s, const char *text, int length, yyltype *loc)
+{
+  uint32_t value;
+  std::from_chars_result r = std::from_chars(text + 2, text + length, value, 16);
+  if (r.ec != std::errc()) {
+    ReportError::IntegerOutOfRange(s, loc, std::string(text, length).c_str());
+    return 0;
+  }
+  return (int32_t)value;
+}
+
+double ConvertDouble(Scanner *s, const char *text, int length, yyltype *loc)
+{
+  double value;
+  std::from_chars_result r = std::from_chars(text, text + length, value);
+  if (r.ec != std::errc()) {
+    ReportError::DoubleOutOfRange(s, loc, std::string(text, length).c_str());
+    return 0;
+  }
+  return value;
+}
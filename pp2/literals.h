@@ -0,0 +1,33 @@
+/* File: literals.h
+ * ----------------
+ * This file defines how the scanner turns the text of a numeric constant
+ * into its value. The conversions work on the token's characters where
+ * they are (they need not be NUL-terminated), don't allocate, and don't
+ * depend on the locale, unlike the strtol and atof calls they replace.
+ * They are built on std::from_chars.
+ *
+ * Integer constants are 32-bit ints. A decimal one must be at most
+ * 2147483647. A hex one may be up to 0xFFFFFFFF and is taken as the bit
+ * pattern of the int, so 0xFFFFFFFF is -1. A double constant must be a
+ * finite double and, unless it is written as zero, not so small that it
+ * rounds to zero. Constants out of range are reported (through
+ * ReportError, as errors in s's input at the given location) and get
+ * the value 0, where strtol used to saturate and the conversion to int
+ * to wrap.
+ */
+
+#ifndef _H_literals
+#define _H_literals
+
+#include "location.h"
+
+struct Scanner;
+
+// text is the length characters of the token: decimal digits for
+// ConvertInteger, 0x or 0X and hex digits for ConvertHexInteger, and a
+// double constant as the scanner matches them for ConvertDouble
+int ConvertInteger(Scanner *s, const char *text, int length, yyltype *loc);
+int ConvertHexInteger(Scanner *s, const char *text, int length, yyltype *loc);
+double ConvertDouble(Scanner *s, const char *text, int length, yyltype *loc);
+
+#endif
@@ -2,18 +2,40 @@
  * ----------------
  * This file just contains features relative to the location structure
  * used to record the lexical position of a token or symbol.  This file
- * establishes the cmoon definition for the yyltype structure, the global
- * variable yylloc, and a utility function to join locations you might
- * find handy at times.
+ * establishes the cmoon definition for the yyltype structure and a
+ * utility function to join locations you might find handy at times.
+ *
+ * There are two ways of keeping locations, chosen when dcc is built
+ * (LOCATIONS in the Makefile). By default a yyltype holds the line and
+ * columns, which the scanner works out for every match. Built with
+ * LOCATIONS=compact (which defines COMPACT_LOCATIONS), it holds only the
+ * offset of the first character in the source and the length, and the
+ * line and columns are looked up from the source buffer's line table
+ * when something asks for them with GetPosition: an error message, the
+ * tree printer, the token dump. So those need the source the location
+ * is in. That takes the column arithmetic out of
+ * the scanner, and lets every Node keep its location inline instead of
+ * allocating it.
  */
 
 #ifndef YYLTYPE
 
+#include <stdint.h>
+
+class SourceBuffer;
+
 /* Typedef: yyltype
  * ----------------
  * Defines the struct type that is used by the scanner to store
  * position information about each lexeme scanned.
  */
+#ifdef COMPACT_LOCATIONS
+typedef struct yyltype
+{
+    uint32_t offset;               // of the first character in the source
+    uint32_t length;               // in characters, through the last one
+} yyltype;
+#else
 typedef struct yyltype
 {
     int timestamp;                 // you can ignore this field
@@ -21,18 +43,11 @@ typedef struct yyltype
     int last_line, last_column;      
     char *text;                    // you can also ignore this field
 } yyltype;
+#endif
 
 #define YYLTYPE yyltype
 
 
-/* Global variable: yylloc
- * ------------------------
- * The global variable holding the position information about the
- * lexeme just scanned.
- */
-extern struct yyltype yylloc;
-
-
 /* Function: Join
  * --------------
  * Takes two locations and returns a new location which represents
@@ -41,10 +56,15 @@ extern struct yyltype yylloc;
 inline yyltype Join(yyltype first, yyltype last)
 {
   yyltype combined;
+#ifdef COMPACT_LOCATIONS
+  combined.offset = first.offset;
+  combined.length = last.offset + last.length - first.offset;
+#else
   combined.first_column = first.first_column;
   combined.first_line = first.first_line;
   combined.last_column = last.last_column;
   combined.last_line = last.last_line;
+#endif
   return combined;
 }
 
@@ -55,5 +75,71 @@ inline yyltype Join(yyltype *firstPtr, yyltype *lastPtr)
 }
 
 
+/* Function: After
+ * ---------------
+ * Returns an empty location just past the end of loc, which is what
+ * yacc gives a rule that matched nothing.
+ */
+inline yyltype After(yyltype loc)
+{
+  yyltype empty;
+#ifdef COMPACT_LOCATIONS
+  empty.offset = loc.offset + loc.length;
+  empty.length = 0;
+#else
+  empty.first_line = empty.last_line = loc.last_line;
+  empty.first_column = empty.last_column = loc.last_column;
+#endif
+  return empty;
+}
+
+
+/* Type: TextSpan
+ * --------------
+ * A piece of the source text, which is not NUL-terminated. String
+ * constants are passed from the scanner to the parser and kept in the
+ * tree this way, pointing into the source buffer (see sourcebuf.h)
+ * rather than at copies of their own. The source stays in memory, and
+ * unchanged, as long as its scanner is open; for a compile, that is
+ * until its CompileContext is deleted (see context.h), and a span must
+ * not be used after that.
+ */
+struct TextSpan {
+  const char *text;
+  int length;
+};
+
+
+/* Type: Position
+ * --------------
+ * Where a location is, as messages show it: the line it starts on and
+ * the columns of its first and last characters. The last column is
+ * counted on from the first, as the scanner counts a match, so for a
+ * location that spans lines it is past the end of the first.
+ */
+struct Position {
+  int line, firstColumn, lastColumn;
+};
+
+#ifdef COMPACT_LOCATIONS
+/* Function: GetPosition
+ * ---------------------
+ * Looks up the line and columns of loc in source, the input it is a
+ * location in (see sourcebuf.h). Tabs move the column to the next tab
+ * stop, as the scanner's tab rule does; one difference from the full
+ * locations is that a tab inside a string constant does too, where the
+ * scanner counts the whole string a character per column. Defined in
+ * sourcebuf.cc. With full locations the source isn't needed.
+ */
+Position GetPosition(SourceBuffer *source, const yyltype *loc);
+#else
+inline Position GetPosition(SourceBuffer *source, const yyltype *loc)
+{
+  Position pos = { loc->first_line, loc->first_column, loc->last_column };
+  return pos;
+}
+#endif
+
+
 #endif
 
@@ -9,23 +9,148 @@
 #include "utility.h"
 #include "errors.h"
 #include "parser.h"
+#include "context.h"
+#include "timing.h"
+#include "memstats.h"
+#include "tracing.h"
+#include "intern.h"
+#include "tokenbuf.h"
+
+
+/* Function: PrintToken()
+ * ----------------------
+ * Prints one line of the token dump: the location, token code and name,
+ * and the attribute value for tokens that carry one. The location is in
+ * source.
+ */
+static void PrintToken(SourceBuffer *source, int token, YYSTYPE *value,
+                       yyltype *loc)
+{
+    Position pos = GetPosition(source, loc);
+    printf("%d.%d-%d %d %s", pos.line, pos.firstColumn, pos.lastColumn,
+           token, GetTokenName(token));
+    switch (token) {
+      case T_Identifier:     printf(" %s", InternTable::GetName(value->identifier)); break;
+      case T_StringConstant: printf(" %.*s", value->stringConstant.length,
+                                    value->stringConstant.text); break;
+      case T_IntConstant:    printf(" %d", value->integerConstant); break;
+      case T_DoubleConstant: printf(" %g", value->doubleConstant); break;
+      case T_BoolConstant:   printf(" %s", value->boolConstant ? "true" : "false"); break;
+    }
+    printf("\n");
+}
+
+/* Function: ScanOnly()
+ * --------------------
+ * Runs just the scanner over the entire input, without the parser. This
+ * is what the "lexonly" debug key selects, to measure the scanner on its
+ * own. With the "tokens" key each token is also printed as it is read,
+ * and with the "rules" key we finish with the scanner's rule histogram.
+ * If the input has been scanned into a token buffer already, the tokens
+ * are read from there, so the dump shows what the parser would get.
+ */
+static void ScanOnly(CompileContext *context)
+{
+    bool dump = IsDebugOn("tokens");
+    int token, numTokens = 0;
+    TokenBuffer *tokens = context->GetTokenSource();
+    Scanner *scanner = context->GetScanner();
+    YYSTYPE value;
+    yyltype loc;
+
+    Timing::Push(PhaseScan);
+    while ((token = tokens ? tokens->Next(&value, &loc)
+                           : ScanToken(scanner, &value, &loc)) != 0) {
+        numTokens++;
+        if (dump) PrintToken(context->GetSource(), token, &value, &loc);
+    }
+    Timing::Pop();
+
+    if (IsDebugOn("rules")) PrintRuleHistogram(scanner);
+    PrintDebug("lex", "Scanned %d tokens", numTokens);
+}
 
 
 /* Function: main()
  * ----------------
  * Entry point to the entire program.  We parse the command line and turn
  * on any debugging flags requested by the user when invoking the program.
- * InitScanner() is used to set up the scanner.
- * InitParser() is used to set up the parser. The call to yyparse() will
- * attempt to parse a complete program from the input. 
+ * The source is read from the file named by the first argument, if it
+ * is not an option, and from stdin otherwise.
+ * InitScanner() is used to set up the scanner, which is handed to the
+ * CompileContext (see context.h) for the compile.
+ * InitParser() is used to set up the parser. The context's Parse() will
+ * attempt to parse a complete program from the input (or, with the
+ * "lexonly" key, ScanOnly() runs just the scanner), and if that goes
+ * without errors the tree is printed. Each step is
+ * bracketed by Timing calls, which do nothing unless the "timing" debug
+ * key was given, in which case a summary is printed at the end. The
+ * "alloc" key likewise prints the allocation census (see memstats.h),
+ * "mem" a summary of the memory in use at exit, and "reductions" the
+ * parser's per-rule and per-token counts. The
+ * "peakrss" key prints the peak memory use, for the check target, and
+ * "trace" writes a timeline of the compile to dcc.trace.json (see
+ * tracing.h). With the "pretok" key the whole input is scanned into a
+ * token buffer (see tokenbuf.h) before parsing starts.
  */
 int main(int argc, char *argv[])
 {
+    const char *filename = NULL;
+    if (argc > 1 && argv[1][0] != '-') {
+        filename = argv[1];
+        argv[1] = argv[0];
+        argc--, argv++;
+    }
     ParseCommandLine(argc, argv);
-  
-    InitScanner();
+    Timing::Init();
+    MemStats::Init();
+    Trace::Init();
+
+    Timing::Push(PhaseScannerInit);
+    Trace::Begin("scanner init", "compile");
+    CompileContext *context = new CompileContext(InitScanner(filename));
+    Trace::End();
+    Timing::Pop();
+    TokenBuffer *tokens = NULL;
+    if (IsDebugOn("pretok")) {
+        Trace::Begin("pretokenize", "compile");
+        Timing::Push(PhaseScan);
+        tokens = TokenBuffer::Scan(context->GetScanner());
+        context->SetTokenSource(tokens);
+        Timing::Pop();
+        Trace::End();
+    }
+    Trace::Begin(IsDebugOn("lexonly") ? "scan" : "parse", "compile");
+    Timing::Push(PhaseParserInit);
     InitParser();
-    yyparse();
-    return (ReportError::NumErrors() == 0? 0 : -1);
+    Timing::Pop();
+    if (IsDebugOn("lexonly")) {
+        ScanOnly(context);
+    } else {
+        Timing::Push(PhaseParse);
+        context->Parse();
+        // if no errors, advance to next phase
+        Program *program = context->GetProgram();
+        if (program && context->NumErrors() == 0) {
+            Timing::Push(PhasePrint);
+            Trace::Begin("print", "print");
+            program->Print(0);
+            Trace::End();
+            Timing::Pop();
+        }
+        Timing::Pop();
+        if (IsDebugOn("reductions")) PrintParserCounts(context);
+    }
+    Trace::End();
+
+    Timing::PrintSummary();
+    MemStats::PrintReport();
+    MemStats::PrintSummary();
+    if (IsDebugOn("peakrss")) {
+        fflush(stdout);
+        fprintf(stderr, "peak RSS: %ld KB\n", MemStats::PeakRSS());
+    }
+    Trace::Finish();
+    return (context->NumErrors() == 0? 0 : -1);
 }
 
@@ -0,0 +1,204 @@
+/* File: memstats.cc
+ * -----------------
+ * Implementation of the allocation census.
+ */
+
+#include "memstats.h"
+#include <cxxabi.h>   // for abi::__cxa_demangle
+#include <malloc.h>   // for mallinfo2
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+#include "utility.h"
+#include "ast.h"
+
+bool MemStats::on = false;
+
+// All buckets, linked through their next fields. This is a plain pointer
+// so it is already set up when static buckets register themselves.
+static AllocBucket *buckets = NULL;
+
+// Address and size of every node allocated while counting is on
+static std::vector<std::pair<void*, size_t> > nodes;
+
+static const char *categoryNames[NumMemCategories] = {
+  "source buffer", "AST nodes", "node locations", "lists", "strings"
+};
+
+
+AllocBucket::AllocBucket(const char *n, memCategoryT c, const char *t)
+{
+  name = n;
+  typeName = t;
+  category = c;
+  count = bytes = 0;
+  next = buckets;
+  buckets = this;
+}
+
+void MemStats::Init()
+{
+  on = IsDebugOn("alloc") || IsDebugOn("mem");
+}
+
+void MemStats::Allocated(AllocBucket *b, size_t size, bool count)
+{
+  if (count) b->count++;
+  b->bytes += size;
+}
+
+void MemStats::Freed(AllocBucket *b, size_t size)
+{
+  b->bytes -= size;
+}
+
+void MemStats::NodeAllocated(void *node, size_t size)
+{
+  nodes.push_back(std::make_pair(node, size));
+}
+
+char *MemStats::Strdup(const char *str, AllocBucket *b)
+{
+  if (on) Allocated(b, strlen(str) + 1);
+  return strdup(str);
+}
+
+
+/* Returns the value of a "Name: N kB" line of /proc/self/status, or -1.
+ * format is the sscanf format for the line, e.g. "VmHWM: %ld kB".
+ */
+static long ReadStatusKB(const char *format)
+{
+  FILE *fp = fopen("/proc/self/status", "r");
+  if (!fp) return -1;
+  char line[256];
+  long kb = -1;
+  while (fgets(line, sizeof(line), fp))
+    if (sscanf(line, format, &kb) == 1) break;
+  fclose(fp);
+  return kb;
+}
+
+long MemStats::PeakRSS()
+{
+  return ReadStatusKB("VmHWM: %ld kB");
+}
+
+long MemStats::CurrentRSS()
+{
+  return ReadStatusKB("VmRSS: %ld kB");
+}
+
+
+/* Returns the demangled form of a type name as reported by typeid, or
+ * the name itself if it can't be demangled.
+ */
+static std::string Demangle(const char *mangled)
+{
+  int status;
+  char *d = abi::__cxa_demangle(mangled, NULL, NULL, &status);
+  std::string result(status == 0 ? d : mangled);
+  free(d);
+  return result;
+}
+
+struct CensusLine {
+  std::string name;
+  long count, bytes;
+};
+
+static bool MoreBytes(const CensusLine &a, const CensusLine &b)
+{
+  return a.bytes > b.bytes;
+}
+
+static void PrintCategory(const char *title, std::vector<CensusLine> &lines)
+{
+  long count = 0, bytes = 0;
+  std::sort(lines.begin(), lines.end(), MoreBytes);
+  fprintf(stderr, "%s\n", title);
+  for (size_t i = 0; i < lines.size(); i++) {
+    CensusLine &l = lines[i];
+    fprintf(stderr, "  %-34s %10ld %12ld %8.1f\n", l.name.c_str(), l.count,
+            l.bytes, l.count ? (double)l.bytes/l.count : 0.0);
+    count += l.count;
+    bytes += l.bytes;
+  }
+  fprintf(stderr, "  %-34s %10ld %12ld\n", "(subtotal)", count, bytes);
+}
+
+void MemStats::PrintReport()
+{
+  if (!on || !IsDebugOn("alloc")) return;
+
+  std::vector<CensusLine> lines[NumMemCategories];
+
+  std::map<std::string, CensusLine> byClass;
+  for (size_t i = 0; i < nodes.size(); i++) {
+    Node *n = (Node *)nodes[i].first;
+    CensusLine &l = byClass[typeid(*n).name()];
+    l.count++;
+    l.bytes += nodes[i].second;
+  }
+  for (std::map<std::string, CensusLine>::iterator i = byClass.begin();
+       i != byClass.end(); ++i) {
+    i->second.name = Demangle(i->first.c_str());
+    lines[MemNodes].push_back(i->second);
+  }
+
+  for (AllocBucket *b = buckets; b != NULL; b = b->next) {
+    CensusLine l;
+    l.name = b->typeName ? "List<" + Demangle(b->typeName) + ">" : b->name;
+    l.count = b->count;
+    l.bytes = b->bytes;
+    lines[b->category].push_back(l);
+  }
+
+  fflush(stdout);
+  fprintf(stderr, "\n%-36s %10s %12s %8s\n", "allocation census", "count",
+          "bytes", "avg");
+  for (int c = 0; c < NumMemCategories; c++)
+    PrintCategory(categoryNames[c], lines[c]);
+}
+
+
+/* The summary folds node locations into the AST nodes they belong to,
+ * since each one is allocated by (and only for) a Node.
+ */
+void MemStats::PrintSummary()
+{
+  if (!on || !IsDebugOn("mem")) return;
+
+  long count[NumMemCategories] = {0}, bytes[NumMemCategories] = {0};
+  for (size_t i = 0; i < nodes.size(); i++) {
+    count[MemNodes]++;
+    bytes[MemNodes] += nodes[i].second;
+  }
+  for (AllocBucket *b = buckets; b != NULL; b = b->next) {
+    memCategoryT c = (b->category == MemLocations ? MemNodes : b->category);
+    if (b->category != MemLocations) count[c] += b->count;
+    bytes[c] += b->bytes;
+  }
+
+  long total = 0;
+  fflush(stdout);
+  fprintf(stderr, "\nmemory at exit\n");
+  fprintf(stderr, "  %-22s %9ld KB\n", "peak RSS", PeakRSS());
+  fprintf(stderr, "  %-22s %9ld KB\n", "current RSS", CurrentRSS());
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 33)
+  fprintf(stderr, "  %-22s %9ld KB\n", "malloc in use",
+          (long)(mallinfo2().uordblks / 1024));
+#endif
+  fprintf(stderr, "%-24s %12s %10s\n", "live heap", "bytes", "count");
+  for (int c = 0; c < NumMemCategories; c++) {
+    if (c == MemLocations) continue;
+    fprintf(stderr, "  %-22s %12ld %10ld\n", categoryNames[c], bytes[c],
+            count[c]);
+    total += bytes[c];
+  }
+  fprintf(stderr, "  %-22s %12ld\n", "(total)", total);
+}
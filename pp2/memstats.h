@@ -0,0 +1,137 @@
+/* File: memstats.h
+ * ----------------
+ * This file defines an opt-in allocation census. When the "alloc" debug
+ * key is set (dcc -d alloc), the allocations made for the parse tree are
+ * counted and a report is printed to stderr at exit, broken down by
+ *
+ *   - AST node class (every Node subclass allocated with new),
+ *   - the location record each Node allocates for itself,
+ *   - List<T> instantiation (the List objects plus their deque storage),
+ *   - string buffer (the interned identifier names and their hash table,
+ *     and the strdup'd copies of type names; string constants are not
+ *     copied, see TextSpan in location.h).
+ *
+ * Allocations are counted as requested; malloc's own per-block overhead
+ * is not included. When the key is not set, each hook costs one test of
+ * a static flag.
+ *
+ * The "mem" debug key turns on the same counting but prints a short
+ * summary instead: the peak and current RSS, malloc's bytes in use, and
+ * the live bytes counted for each category. The compiler frees almost
+ * nothing, so live bytes are nearly all that was ever allocated. What the
+ * source buffer (sourcebuf.h) allocates to keep the input and its line
+ * index is its own category; a mapped source file isn't heap and doesn't
+ * appear in it.
+ *
+ * Nodes are tallied by class at report time: Node::operator new records
+ * the address and size of each node, and the report asks each node for
+ * its dynamic type. Everything else is charged to an AllocBucket, a
+ * named counter that registers itself on first use.
+ */
+
+#ifndef _H_memstats
+#define _H_memstats
+
+#include <stddef.h>
+#include <memory>   // for std::allocator
+#include <typeinfo>
+
+typedef enum { MemSourceLines, MemNodes, MemLocations, MemLists, MemStrings,
+               NumMemCategories } memCategoryT;
+
+class AllocBucket
+{
+ public:
+  // If typeName is given, the bucket is reported as List<typeName>,
+  // demangled. Buckets add themselves to a global list of buckets.
+  AllocBucket(const char *name, memCategoryT category,
+              const char *typeName = NULL);
+
+  const char *name;
+  const char *typeName;
+  memCategoryT category;
+  long count, bytes;
+  AllocBucket *next;
+};
+
+
+class MemStats
+{
+ public:
+
+  // Turns counting on if the "alloc" or "mem" debug key is set
+  static void Init();
+
+  static bool IsOn() { return on; }
+
+  // Charges an allocation of size bytes to the bucket. count says
+  // whether it is a new object or more storage for an existing one.
+  static void Allocated(AllocBucket *b, size_t size, bool count = true);
+  static void Freed(AllocBucket *b, size_t size);
+
+  // Records a new AST node; its class is looked up at report time
+  static void NodeAllocated(void *node, size_t size);
+
+  // Same as strdup, charging the copy to the bucket
+  static char *Strdup(const char *str, AllocBucket *b);
+
+  // Prints the census to stderr (if the "alloc" key is set)
+  static void PrintReport();
+
+  // Prints the memory summary to stderr (if the "mem" key is set)
+  static void PrintSummary();
+
+  // Return the peak and current resident set size of the process in
+  // kilobytes, as reported by the kernel (VmHWM and VmRSS in
+  // /proc/self/status), or -1 if it is not available
+  static long PeakRSS();
+  static long CurrentRSS();
+
+ private:
+  static bool on;
+};
+
+
+/* Template: ListBucket
+ * --------------------
+ * Returns the bucket for a List<Element> instantiation. Each List type
+ * gets one, which also collects the storage its deque allocates.
+ */
+template<class Element> AllocBucket *ListBucket()
+{
+  static AllocBucket bucket("List", MemLists, typeid(Element).name());
+  return &bucket;
+}
+
+
+/* Template: CountingAllocator
+ * ---------------------------
+ * A std::allocator that charges what it hands out to ListBucket<Tag>.
+ * The deque in List uses it, and rebinds it for its internal block map,
+ * so all of a list's storage ends up in the list's bucket.
+ */
+template<class T, class Tag> class CountingAllocator
+{
+ public:
+  typedef T value_type;
+  template<class U> struct rebind { typedef CountingAllocator<U, Tag> other; };
+
+  CountingAllocator() {}
+  template<class U> CountingAllocator(const CountingAllocator<U, Tag> &) {}
+
+  T *allocate(size_t n)
+      { if (MemStats::IsOn())
+            MemStats::Allocated(ListBucket<Tag>(), n * sizeof(T), false);
+        return std::allocator<T>().allocate(n); }
+  void deallocate(T *p, size_t n)
+      { if (MemStats::IsOn())
+            MemStats::Freed(ListBucket<Tag>(), n * sizeof(T));
+        std::allocator<T>().deallocate(p, n); }
+
+  template<class U> bool operator==(const CountingAllocator<U, Tag> &) const
+      { return true; }
+  template<class U> bool operator!=(const CountingAllocator<U, Tag> &) const
+      { return false; }
+};
+
+#endif
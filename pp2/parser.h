@@ -28,11 +28,17 @@
 // we are compiling y.tab.c, which we use the YYBISON symbol for. 
 // Managing C headers can be such a mess! 
 
+class CompileContext;           // passed to yyparse, see context.h
+
 #ifndef YYBISON                 
 #include "y.tab.h"              
 #endif
 
-int yyparse();              // Defined in the generated y.tab.c file
+int yyparse(CompileContext *context); // Defined in the generated y.tab.c file
 void InitParser();          // Defined in parser.y
+const char *GetTokenName(int token); // ditto
+void PrintParserCounts(CompileContext *context); // ditto
+struct ParserCounts *NewParserCounts(); // ditto, see context.h
+void DeleteParserCounts(struct ParserCounts *counts); // ditto
 
 #endif
@@ -16,11 +16,43 @@
  * file inclusions or C++ variable declarations/prototypes that are needed
  * by your code here.
  */
-#include "scanner.h" // for yylex
+#include "scanner.h" // for ScanToken
 #include "parser.h"
+#include "context.h"
 #include "errors.h"
-
-void yyerror(const char *msg); // standard error-handling routine
+#include "timing.h"
+#include "tracing.h"
+#include "tokenbuf.h"
+
+// standard error-handling routine, see errors.cc
+void yyerror(YYLTYPE *loc, CompileContext *context, const char *msg);
+
+/* The parser asks for tokens through ReadToken(), which reads them from
+ * the context's scanner (or its token buffer, if it was given one, see
+ * tokenbuf.h), counts the tokens shifted and charges the time spent in
+ * the scanner to the scan phase of the timing report. Likewise our
+ * YYLLOC_DEFAULT (which yacc runs at the start of every reduction, with
+ * yyn holding the number of the rule being reduced) counts the
+ * reduction and switches to the build phase, so the time spent in the
+ * actions that construct the tree is reported apart from the parsing
+ * proper. Other than that it is the same as yacc's default. (yacc also
+ * uses YYLLOC_DEFAULT when recovering from errors, but our grammar has
+ * no error productions, so it never gets there.)
+ */
+static int ReadToken(YYSTYPE *value, YYLTYPE *loc, CompileContext *context);
+static inline void CountReduction(CompileContext *context, int rule);
+static void TraceDecl(CompileContext *context, Decl *decl);
+#define yylex ReadToken
+
+#define YYLLOC_DEFAULT(Current, Rhs, N)                               \
+    do {                                                              \
+      CountReduction(context, yyn);                                   \
+      Timing::Switch(PhaseBuild);                                     \
+      if (N)                                                          \
+          (Current) = Join(YYRHSLOC(Rhs, 1), YYRHSLOC(Rhs, N));       \
+      else                                                            \
+          (Current) = After(YYRHSLOC(Rhs, 0));                        \
+    } while (0)
 
 %}
 
@@ -28,6 +60,18 @@ void yyerror(const char *msg); // standard error-handling routine
  * input file. Here is where you declare tokens and types, add precedence
  * and associativity options, and so on.
  */
+
+/* The parser is pure: rather than the globals yylval, yylloc and yychar
+ * it keeps the token's value and location in yyparse's own variables,
+ * and hands them to ReadToken and yyerror to fill in. Everything else
+ * about the parse is in the CompileContext (see context.h) passed to
+ * yyparse, which it passes on to ReadToken and the actions, so parses
+ * can run on several threads at once.
+ */
+%define api.pure full
+%locations
+%parse-param {CompileContext *context}
+%lex-param {CompileContext *context}
  
 /* yylval 
  * ------
@@ -42,9 +86,9 @@ void yyerror(const char *msg); // standard error-handling routine
 %union {
     int integerConstant;
     bool boolConstant;
-    char *stringConstant;
+    TextSpan stringConstant;        // the token's text, see location.h
     double doubleConstant;
-    char identifier[MaxIdentLen+1]; // +1 for terminating null
+    int identifier;                 // symbol from the InternTable
     Decl *decl;
     VarDecl *var;
     FnDecl *fDecl;
@@ -152,19 +196,13 @@ void yyerror(const char *msg); // standard error-handling routine
 /***************************************************************/
 %%
 Program   :    DeclList            { 
-                                      @1; 
-                                      /* pp2: The @1 is needed to convince 
-                                       * yacc to set up yylloc. You can remove 
-                                       * it once you have other uses of @n*/
-                                      Program *program = new Program($1);
-                                      // if no errors, advance to next phase
-                                      if (ReportError::NumErrors() == 0) 
-                                          program->Print(0);
+                                      // printed by main if there were no errors
+                                      context->SetProgram(new Program($1, context->GetSource()));
                                     }
 ;
 
-DeclList  :    DeclList Decl        { ($$ = $1)->Append($2); }
-          |    Decl                 { ($$ = new List<Decl*>)->Append($1); }
+DeclList  :    DeclList Decl        { ($$ = $1)->Append($2); TraceDecl(context, $2); }
+          |    Decl                 { ($$ = new List<Decl*>)->Append($1); TraceDecl(context, $1); }
 ;
 
 Decl      :    VarDecl              { $$ = $1; }
@@ -405,9 +443,160 @@ ProtoList      : Prototype                                    { ($$ = new List<D
  * you a running trail that might be helpful when debugging your parser.
  * Please be sure the variable is set to false when submitting your final
  * version.
+ * Everything about a single parse is in its CompileContext; this is
+ * only called once, before the first one.
  */
+static double declStart;   // when the current top-level Decl began, for the trace
+
 void InitParser()
 {
    PrintDebug("parser", "Initializing parser");
    yydebug = false;
+   declStart = Timing::Now();
+}
+
+
+/* Function: TraceDecl
+ * -------------------
+ * Adds a span for a top-level declaration to the trace (see tracing.h),
+ * named by its node type and identifier, e.g. "FnDecl main". The span
+ * runs from the end of the previous top-level declaration, so it covers
+ * scanning and parsing the declaration and building its tree. Since a
+ * declaration is reduced only after its lookahead has been read, the
+ * boundaries are off by one token.
+ */
+static void TraceDecl(CompileContext *context, Decl *decl)
+{
+   if (!Trace::IsOn()) return;
+   char name[128];
+   snprintf(name, sizeof(name), "%s %s", decl->GetPrintNameForNode(),
+            decl->GetId()->GetName());
+   Trace::Complete(name, "decl", declStart,
+                   GetPosition(context->GetSource(), decl->GetLocation()).line);
+   declStart = Timing::Now();
+}
+
+
+/* Parser counters
+ * ---------------
+ * How many times each rule was reduced, indexed by yacc's internal rule
+ * number (one more than the rule's number in y.output), and how many
+ * times each token was shifted, indexed by yacc's internal symbol
+ * number. The lookahead that causes a syntax error is counted as a shift
+ * too, although the parse stops there. PrintParserCounts reports them.
+ * Each context keeps its own, and only with the "reductions" debug key
+ * (see context.h); the sizes come from the tables in y.tab.c, which is
+ * why they are defined here.
+ */
+struct ParserCounts {
+   int reductions[YYNRULES+1];
+   int shifts[YYNTOKENS];
+};
+
+ParserCounts *NewParserCounts()
+{
+   return new ParserCounts();  // all zero
+}
+
+void DeleteParserCounts(ParserCounts *counts)
+{
+   delete counts;
+}
+
+static inline void CountReduction(CompileContext *context, int rule)
+{
+   ParserCounts *counts = context->GetParserCounts();
+   if (counts) counts->reductions[rule]++;
+}
+
+
+/* Function: ReadToken
+ * -------------------
+ * Stands in for yylex() in the generated parser (see the #define at the
+ * top of this file): returns the next token of the context's input, with
+ * its value and location. Any time since the last reduction was spent by
+ * the parser itself, so we switch back to the parse phase before timing
+ * the call into the scanner. When the input was scanned ahead of time
+ * into a token buffer (see CompileContext::SetTokenSource), tokens come
+ * from there instead.
+ */
+#undef yylex
+static int ReadToken(YYSTYPE *value, YYLTYPE *loc, CompileContext *context)
+{
+   int token;
+   TokenBuffer *tokens = context->GetTokenSource();
+   if (tokens) {
+      if (Timing::IsOn()) Timing::Switch(PhaseParse);
+      token = tokens->Next(value, loc);
+   } else if (Timing::IsOn()) {
+      Timing::Switch(PhaseParse);
+      Timing::Push(PhaseScan);
+      token = ScanToken(context->GetScanner(), value, loc);
+      Timing::Pop();
+   } else
+      token = ScanToken(context->GetScanner(), value, loc);
+   ParserCounts *counts = context->GetParserCounts();
+   if (counts && token != 0) counts->shifts[YYTRANSLATE(token)]++;
+   return token;
+}
+
+
+/* Function: GetTokenName
+ * ----------------------
+ * Returns the name yacc uses for a token code returned by yylex, e.g.
+ * "T_Identifier" or "'+'". Used by the scanner-only token dump.
+ */
+const char *GetTokenName(int token)
+{
+   return yytname[YYTRANSLATE(token)];
+}
+
+
+/* Function: PrintParserCounts
+ * ---------------------------
+ * Prints the reduction count of every rule that was reduced, and the
+ * shift count of every token that was shifted, most frequent first, to
+ * stderr. Rules are shown with their y.output number, the nonterminal
+ * on the left side and the line of parser.y they are written on.
+ */
+static void SortByCount(int *order, int n, const int *counts)
+{
+   for (int i = 1; i < n; i++) {
+      int k = order[i], j = i;
+      for (; j > 0 && counts[order[j-1]] < counts[k]; j--)
+         order[j] = order[j-1];
+      order[j] = k;
+   }
+}
+
+void PrintParserCounts(CompileContext *context)
+{
+   ParserCounts *counts = context->GetParserCounts();
+   if (counts == NULL) return;
+   const int *reductions = counts->reductions, *shifts = counts->shifts;
+   int order[YYNRULES+YYNTOKENS+1], n = 0;
+   long total = 0;
+
+   for (int r = 1; r <= YYNRULES; r++)
+      if (reductions[r] > 0) { order[n++] = r; total += reductions[r]; }
+   SortByCount(order, n, reductions);
+   fprintf(stderr, "\n%6s %10s %7s  %-14s %s\n", "rule", "reductions", "%",
+           "lhs", "line");
+   for (int i = 0; i < n; i++) {
+      int r = order[i];
+      fprintf(stderr, "%6d %10d %6.1f%%  %-14s parser.y:%d\n", r - 1,
+              reductions[r], 100.0 * reductions[r] / total, yytname[yyr1[r]],
+              (int)yyrline[r]);
+   }
+   fprintf(stderr, "%6s %10ld\n", "total", total);
+
+   n = total = 0;
+   for (int t = 0; t < YYNTOKENS; t++)
+      if (shifts[t] > 0) { order[n++] = t; total += shifts[t]; }
+   SortByCount(order, n, shifts);
+   fprintf(stderr, "\n%-18s %10s %7s\n", "token", "shifts", "%");
+   for (int i = 0; i < n; i++)
+      fprintf(stderr, "%-18s %10d %6.1f%%\n", yytname[order[i]],
+              shifts[order[i]], 100.0 * shifts[order[i]] / total);
+   fprintf(stderr, "%-18s %10ld\n", "total", total);
 }
@@ -3,6 +3,24 @@
  * You should not need to modify this file. It declare a few constants,
  * types, variables,and functions that are used and/or exported by
  * the lex-generated scanner.
+ *
+ * The scanner is reentrant: a Scanner holds everything about scanning
+ * one input (the source buffer, the position in it, the current line
+ * and column, the rule histogram), and any number of them can be open
+ * at once. Different scanners can be used on different threads at the
+ * same time, but one scanner only by one thread at a time. Identifiers
+ * from all of them go into the one InternTable (intern.h), which is
+ * safe to share. The debugging reports (timing, tracing and the
+ * allocation census) are not, so leave those keys off when scanning on
+ * several threads.
+ *
+ * The parser is too: it reads from the scanner of the CompileContext
+ * it is given (see context.h), through ScanToken, and there are no
+ * global yylval and yylloc.
+ *
+ * Errors the scanner finds are reported (see errors.h) with the scanner,
+ * so that the messages quote lines of its own input, and counted by the
+ * context it belongs to, if it was given one.
  */
 
 #ifndef _H_scanner
@@ -12,14 +30,45 @@
 
 #define MaxIdentLen 31    // Maximum length for identifiers
 
-extern char *yytext;      // Text of lexeme just scanned
+struct Scanner;
+struct yyltype;
+union YYSTYPE;
+class SourceBuffer;
+class CompileContext;
 
+// Opens a scanner on the named file, or stdin if filename is NULL;
+// returns NULL, with errno set, if it can't be read
+Scanner *OpenScanner(const char *filename);
 
-int yylex();              // Defined in the generated lex.yy.c file
-void yyrestart(FILE *fp); // ditto
+// Opens a scanner on source that starts at offset, which must be where
+// the scanner could be between two tokens outside of any comment: the
+// start of the text (line 1, column 1), or just past a token, at the
+// line and column the scanner had there (the token's line and last
+// column plus one; see TokenBuffer::Rescan). The source is not the
+// scanner's; closing it leaves the source open.
+Scanner *OpenScanner(SourceBuffer *source, size_t offset, int line,
+                     int column);
+void CloseScanner(Scanner *s);
 
+// Returns the next token, with its value and location, or 0 at the end
+int ScanToken(Scanner *s, YYSTYPE *value, yyltype *loc);
 
-void InitScanner();                 // Defined in scanner.l user subroutines
-const char *GetLineNumbered(int n); // ditto
+// Offset in the input of the token ScanToken last returned
+size_t GetTokenStart(Scanner *s);
+
+// The input the scanner reads
+SourceBuffer *GetScannerSource(Scanner *s);
+
+// The context the scanner belongs to, which counts the errors it
+// reports, or NULL if it is on its own (CompileContext sets this)
+void SetScannerContext(Scanner *s, CompileContext *context);
+CompileContext *GetScannerContext(Scanner *s);
+
+
+Scanner *InitScanner(const char *filename = NULL); // Defined in scanner.l user subroutines
+void PrintRuleHistogram(Scanner *s);               // ditto
+
+// The hand-written scanner in handscan.cc (make SCANNER=hand) defines
+// all of these instead.
  
 #endif
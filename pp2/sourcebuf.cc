@@ -0,0 +1,341 @@
+/* File: sourcebuf.cc
+ * ------------------
+ * Implementation of the source buffer.
+ */
+
+#include "sourcebuf.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include "location.h"
+#include "memstats.h"
+
+static AllocBucket sourceCopies("source text (not mapped)", MemSourceLines);
+static AllocBucket lineTable("line table", MemSourceLines);
+static AllocBucket editedCopies("source text (edited)", MemSourceLines);
+
+
+SourceBuffer *SourceBuffer::Open(const char *filename)
+{
+  int fd = (filename ? open(filename, O_RDONLY) : STDIN_FILENO);
+  if (fd < 0) return NULL;
+
+  SourceBuffer *source = new SourceBuffer();
+  struct stat st;
+  bool ok;
+  if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode))
+    ok = source->Map(fd, st.st_size);
+  else
+    ok = source->Read(fd);
+  int saved = errno;
+  if (filename) close(fd);
+  if (ok && source->length >= UINT32_MAX - 1) { // see BuildLineTable
+    ok = false;
+    saved = EFBIG;
+  }
+  if (!ok) {
+    delete source;
+    errno = saved;
+    return NULL;
+  }
+  source->BuildLineTable();
+  return source;
+}
+
+SourceBuffer::SourceBuffer()
+{
+  scanText = NULL;
+  text = NULL;
+  length = 0;
+  mapped = false;
+  numLines = 0;
+  lastLocated = 1;
+}
+
+SourceBuffer::~SourceBuffer()
+{
+  if (mapped) {
+    if (scanText) munmap(scanText, length + NumSentinels);
+    if (text && length > 0) munmap((void *)text, length);
+  } else {
+    free(scanText);
+    free((void *)text);
+  }
+}
+
+/* Maps the file twice as described in sourcebuf.h. An empty file
+ * can't be mapped, so its scanner copy is just the NUL bytes.
+ */
+bool SourceBuffer::Map(int fd, size_t size)
+{
+  mapped = true;
+  length = size;
+  void *scan = mmap(NULL, length + NumSentinels, PROT_READ|PROT_WRITE,
+                    MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+  if (scan == MAP_FAILED) return false;
+  scanText = (char *)scan;
+  if (length == 0) {
+    text = scanText;
+    return true;
+  }
+
+  if (mmap(scan, length, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_FIXED,
+           fd, 0) == MAP_FAILED)
+    return false;
+  void *pristine = mmap(NULL, length, PROT_READ, MAP_PRIVATE, fd, 0);
+  if (pristine == MAP_FAILED) return false;
+  text = (const char *)pristine;
+  madvise(scanText, length + NumSentinels, MADV_SEQUENTIAL);
+  return true;
+}
+
+/* Reads fd to the end, doubling the buffer as needed. If it runs out
+ * of memory it fails with ENOMEM, like a failed read.
+ */
+bool SourceBuffer::Read(int fd)
+{
+  size_t capacity = 64 * 1024;
+  char *buf = (char *)malloc(capacity);
+  if (buf == NULL) {
+    errno = ENOMEM;
+    return false;
+  }
+  for (;;) {
+    if (length == capacity) {
+      char *bigger = (char *)realloc(buf, capacity * 2);
+      if (bigger == NULL) {
+        free(buf);
+        errno = ENOMEM;
+        return false;
+      }
+      buf = bigger;
+      capacity *= 2;
+    }
+    ssize_t n = read(fd, buf + length, capacity - length);
+    if (n == 0) break;
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      free(buf);
+      return false;
+    }
+    length += n;
+  }
+  scanText = (char *)malloc(length + NumSentinels);
+  if (scanText == NULL) {
+    free(buf);
+    errno = ENOMEM;
+    return false;
+  }
+  text = buf;
+  memcpy(scanText, text, length);
+  memset(scanText + length, 0, NumSentinels);
+  if (MemStats::IsOn())
+    MemStats::Allocated(&sourceCopies, capacity + length + NumSentinels);
+  return true;
+}
+
+
+/* Newline search
+ * --------------
+ * Each of these looks for newlines in text from offset i up to length,
+ * appends the offset following each one to starts, and returns where it
+ * stopped; the vector versions leave a tail shorter than their block
+ * for the next one. The AVX2 version is compiled for that instruction
+ * set on its own and only called if the CPU has it; SSE2 is part of
+ * x86-64.
+ */
+#if defined(__x86_64__)
+#include <immintrin.h>
+
+__attribute__((target("avx2")))
+static size_t FindNewlinesAVX2(const char *text, size_t i, size_t length,
+                               std::vector<uint32_t> &starts)
+{
+  const __m256i newline = _mm256_set1_epi8('\n');
+  for (; i + 32 <= length; i += 32) {
+    __m256i block = _mm256_loadu_si256((const __m256i *)(text + i));
+    uint32_t mask = _mm256_movemask_epi8(_mm256_cmpeq_epi8(block, newline));
+    for (; mask != 0; mask &= mask - 1)
+      starts.push_back(i + __builtin_ctz(mask) + 1);
+  }
+  return i;
+}
+
+static size_t FindNewlinesSSE2(const char *text, size_t i, size_t length,
+                               std::vector<uint32_t> &starts)
+{
+  const __m128i newline = _mm_set1_epi8('\n');
+  for (; i + 16 <= length; i += 16) {
+    __m128i block = _mm_loadu_si128((const __m128i *)(text + i));
+    uint32_t mask = _mm_movemask_epi8(_mm_cmpeq_epi8(block, newline));
+    for (; mask != 0; mask &= mask - 1)
+      starts.push_back(i + __builtin_ctz(mask) + 1);
+  }
+  return i;
+}
+#endif
+
+static size_t FindNewlinesScalar(const char *text, size_t i, size_t length,
+                                 std::vector<uint32_t> &starts)
+{
+  const char *p = text + i, *end = text + length;
+  while ((p = (const char *)memchr(p, '\n', end - p)) != NULL)
+    starts.push_back(++p - text);
+  return length;
+}
+
+// Runs the widest search the CPU has, then the narrower ones on the rest
+static void FindNewlines(const char *text, size_t length,
+                         std::vector<uint32_t> &starts)
+{
+  size_t i = 0;
+#if defined(__x86_64__)
+  static const bool haveAVX2 = __builtin_cpu_supports("avx2");
+  if (haveAVX2)
+    i = FindNewlinesAVX2(text, i, length, starts);
+  i = FindNewlinesSSE2(text, i, length, starts);
+#endif
+  FindNewlinesScalar(text, i, length, starts);
+}
+
+
+/* The lines are the text between newlines; a newline at the very end
+ * of the text ends the last line, it doesn't start another one. So the
+ * table is the start of the first line, then the offset after every
+ * newline, the last of which is the line-after-the-last's start if the
+ * text ends with a newline; if not, that is one past the end. A final
+ * UINT32_MAX entry stops scans (see GetLineStart).
+ */
+void SourceBuffer::BuildLineTable()
+{
+  lineStarts.reserve(length / 32 + 3);
+  lineStarts.push_back(0);
+  FindNewlines(text, length, lineStarts);
+  if (lineStarts.back() != length)
+    lineStarts.push_back(length + 1);
+  numLines = lineStarts.size() - 1;
+  lineStarts.push_back(UINT32_MAX);
+  if (MemStats::IsOn())
+    MemStats::Allocated(&lineTable, lineStarts.capacity() * sizeof(uint32_t));
+}
+
+/* The lines that start at or before the edit's offset start in the
+ * same places (the newline before each one is before the edit), and
+ * those that start after a newline following the removed bytes just
+ * move by the change in length; in between are the lines that start
+ * after newlines in the inserted text. The end of the table is redone
+ * as in BuildLineTable.
+ */
+SourceBuffer *SourceBuffer::Edit(const SourceEdit &edit)
+{
+  if (edit.offset > length || edit.removed > length - edit.offset) {
+    errno = EINVAL;
+    return NULL;
+  }
+  size_t after = edit.offset + edit.removed;  // end of the removed bytes
+  size_t newLength = length - edit.removed + edit.insertedLength;
+  if (newLength >= UINT32_MAX - 1) {
+    errno = EFBIG;
+    return NULL;
+  }
+
+  char *buf = (char *)malloc(newLength + 1);  // +1 so an empty text isn't NULL
+  char *scan = (char *)malloc(newLength + NumSentinels);
+  if (buf == NULL || scan == NULL) {
+    free(buf);
+    free(scan);
+    errno = ENOMEM;
+    return NULL;
+  }
+  SourceBuffer *b = new SourceBuffer();
+  b->length = newLength;
+  memcpy(buf, text, edit.offset);
+  if (edit.insertedLength > 0)
+    memcpy(buf + edit.offset, edit.inserted, edit.insertedLength);
+  memcpy(buf + edit.offset + edit.insertedLength, text + after,
+         length - after);
+  b->text = buf;
+  b->scanText = scan;
+  memcpy(b->scanText, buf, newLength);
+  memset(b->scanText + newLength, 0, NumSentinels);
+  if (MemStats::IsOn())
+    MemStats::Allocated(&editedCopies, 2 * newLength + 1 + NumSentinels);
+
+  // Every entry but the first, and the closing ones, follows a newline
+  std::vector<uint32_t> &starts = b->lineStarts;
+  std::vector<uint32_t>::iterator first = lineStarts.begin() + 1,
+                                  last = lineStarts.begin() + numLines + 1;
+  if (last[-1] > length) --last;    // no final newline
+  std::vector<uint32_t>::iterator keep =
+      std::upper_bound(first, last, (uint32_t)edit.offset);
+  std::vector<uint32_t>::iterator moved =
+      std::upper_bound(keep, last, (uint32_t)after);
+  starts.reserve((last - first) + edit.insertedLength / 32 + 3);
+  starts.push_back(0);
+  starts.insert(starts.end(), first, keep);
+  size_t inserted = starts.size();
+  FindNewlines(edit.inserted, edit.insertedLength, starts);
+  for (size_t i = inserted; i < starts.size(); i++)
+    starts[i] += edit.offset;
+  for (; moved != last; ++moved)
+    starts.push_back(*moved - edit.removed + edit.insertedLength);
+  if (starts.back() != newLength)
+    starts.push_back(newLength + 1);
+  b->numLines = starts.size() - 1;
+  starts.push_back(UINT32_MAX);
+  if (MemStats::IsOn())
+    MemStats::Allocated(&lineTable, starts.capacity() * sizeof(uint32_t));
+  return b;
+}
+
+const char *SourceBuffer::GetLine(int num, int *lineLength)
+{
+  if (num <= 0 || num > numLines) return NULL;
+  size_t start = lineStarts[num-1];
+  *lineLength = lineStarts[num] - 1 - start;
+  return text + start;
+}
+
+/* The line holding offset is the last one starting at or before it (the
+ * final UINT32_MAX entry never is). Offsets tend to be asked for in
+ * order (the tree printer goes through the tree in source order), so
+ * the line found last time, and the one after it, are tried before
+ * searching the table. The column is counted from the start of the line
+ * a character at a time, with the tab rule's arithmetic.
+ */
+void SourceBuffer::Locate(size_t offset, int *line, int *column)
+{
+  int n = lastLocated;
+  if (lineStarts[n-1] <= offset && offset < lineStarts[n]) {
+    *line = n;
+  } else if (n + 1 <= numLines && lineStarts[n] <= offset &&
+             offset < lineStarts[n+1]) {
+    *line = n + 1;
+  } else {
+    *line = std::upper_bound(lineStarts.begin(), lineStarts.end() - 1, offset)
+            - lineStarts.begin();
+  }
+  lastLocated = *line;
+  int col = 1;
+  for (const char *p = text + lineStarts[*line - 1]; p < text + offset; p++) {
+    col++;
+    if (*p == '\t') col += TabSize - col%TabSize + 1;
+  }
+  *column = col;
+}
+
+#ifdef COMPACT_LOCATIONS
+// Finds the line and columns of a compact location, see location.h
+Position GetPosition(SourceBuffer *source, const yyltype *loc)
+{
+  Position pos;
+  source->Locate(loc->offset, &pos.line, &pos.firstColumn);
+  pos.lastColumn = pos.firstColumn + loc->length - 1;
+  return pos;
+}
+#endif
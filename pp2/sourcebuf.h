@@ -0,0 +1,122 @@
+/* File: sourcebuf.h
+ * -----------------
+ * This file defines a class that holds the whole source being compiled
+ * in memory: one copy for the scanner to work on (with yy_scan_buffer)
+ * and one that is never written to, which error messages quote lines
+ * from.
+ *
+ * A regular file (named on the command line, or redirected to stdin) is
+ * mapped into memory twice. Flex requires the buffer it scans to end
+ * with two NUL bytes, which the file itself doesn't have, so for the
+ * scanner's copy we first reserve an anonymous, zero-filled region two
+ * bytes longer than the file and then map the file over the start of
+ * it. The two bytes past the end of the file are either the kernel's
+ * zero fill of the file's last page or come from the anonymous region,
+ * and are NUL in both cases. That mapping is private and writable since
+ * flex writes into the buffer as it scans (it puts a NUL after the
+ * current token, and restores the character later); the kernel copies
+ * a page the first time flex writes to it. The file itself is never
+ * changed. The second mapping is read-only and shares its pages with
+ * the page cache.
+ *
+ * Anything else (a pipe, say) is read to the end into memory, and then
+ * copied for the scanner.
+ *
+ * Lines are found through a table of where each line starts, built in
+ * one pass over the text that looks for newlines 16 or 32 bytes at a
+ * time (with SSE2 or AVX2, whichever the CPU has, or memchr elsewhere).
+ * The scanner uses it to tell which line a token is on, and error
+ * messages to find the line to quote (and, with compact locations, to
+ * find the line and column of an offset). Offsets in the table are 32 bits,
+ * so a source can't be 4GB or more.
+ *
+ * An edited source (see Edit) is made from the one before the edit: its
+ * text is copied into memory with the edit made, and its line table is
+ * the old one with the lines the edit touched replaced, rather than
+ * found again from the whole text.
+ */
+
+#ifndef _H_sourcebuf
+#define _H_sourcebuf
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+/* Type: SourceEdit
+ * ----------------
+ * A change to a source: the removed bytes at offset are replaced by the
+ * insertedLength bytes at inserted. An insertion removes nothing, and a
+ * deletion inserts nothing.
+ */
+struct SourceEdit {
+  size_t offset;
+  size_t removed;
+  const char *inserted;
+  size_t insertedLength;
+};
+
+class SourceBuffer
+{
+ public:
+  // Number of NUL bytes following the scanner's text, as yy_scan_buffer
+  // requires
+  static const int NumSentinels = 2;
+
+  // Reads the named file, or stdin if filename is NULL, and builds its
+  // line table. Returns NULL (with errno set) if it can't be opened or
+  // read, or is too big.
+  static SourceBuffer *Open(const char *filename);
+
+  // Returns a new buffer holding this one's text with the edit made, or
+  // NULL (with errno set) if the edit reaches past the end of the text
+  // (EINVAL), the result would be too big or there isn't the memory for
+  // it. This buffer is left as it was.
+  SourceBuffer *Edit(const SourceEdit &edit);
+
+  ~SourceBuffer();
+
+  // The copy for the scanner, followed by NumSentinels NUL bytes
+  char *GetScanText()  { return scanText; }
+
+  // The text as it was read, which nothing writes to
+  const char *GetText() { return text; }
+  size_t GetLength()    { return length; }
+
+  // Returns the start of line num (numbered from 1) and sets *lineLength
+  // to its length, not counting the newline, or returns NULL if there is
+  // no such line. The text is not NUL-terminated.
+  const char *GetLine(int num, int *lineLength);
+
+  int GetNumLines()    { return numLines; }
+
+  // Returns the offset at which line num starts, for num from 1 up to
+  // GetNumLines(). For the line after the last one this is just past
+  // the last line's newline (or one more than the length if there is no
+  // final newline), and for the one after that it is SIZE_MAX, so a
+  // scan for the line holding an offset always stops there.
+  size_t GetLineStart(int num)
+      { return lineStarts[num-1] == UINT32_MAX ? SIZE_MAX : lineStarts[num-1]; }
+
+  // Sets *line and *column to where the character at offset is, as the
+  // scanner numbers them: tabs move the column to the next multiple of
+  // TabSize, plus one. (For GetPosition, see location.h.)
+  void Locate(size_t offset, int *line, int *column);
+  static const int TabSize = 8;
+
+ private:
+  SourceBuffer();
+  bool Map(int fd, size_t size);
+  bool Read(int fd);
+  void BuildLineTable();
+
+  char *scanText;
+  const char *text;
+  size_t length;
+  bool mapped;
+  std::vector<uint32_t> lineStarts;
+  int numLines;
+  int lastLocated;      // the line Locate found last time
+};
+
+#endif
@@ -0,0 +1,79 @@
+/* File: timing.cc
+ * ---------------
+ * Implementation of the phase timing class.
+ */
+
+#include "timing.h"
+#include <stdio.h>
+#include <time.h>
+#include "utility.h"
+
+bool Timing::on = false;
+phaseT Timing::stack[MaxDepth];
+int Timing::depth = 0;
+double Timing::last = 0;
+double Timing::total[NumPhases];
+int Timing::entries[NumPhases];
+
+static const char *phaseNames[NumPhases] = {
+  "scanner init", "parser init", "scan", "parse", "build (actions)", "print"
+};
+
+
+void Timing::Init()
+{
+  on = IsDebugOn("timing");
+  depth = 0;
+  last = Now();
+}
+
+double Timing::Now()
+{
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/* Adds the time since the last transition to the phase on top of
+ * the stack. Time spent with nothing on the stack is not reported.
+ */
+void Timing::Charge()
+{
+  double now = Now();
+  if (depth > 0) total[stack[depth-1]] += now - last;
+  last = now;
+}
+
+void Timing::Enter(phaseT p, bool push)
+{
+  if (!push && depth > 0 && stack[depth-1] == p) return;
+  Charge();
+  if (push || depth == 0) {
+    Assert(depth < MaxDepth);
+    depth++;
+  }
+  stack[depth-1] = p;
+  entries[p]++;
+}
+
+void Timing::Leave()
+{
+  Assert(depth > 0);
+  Charge();
+  depth--;
+}
+
+void Timing::PrintSummary()
+{
+  if (!on) return;
+  double sum = 0;
+  for (int i = 0; i < NumPhases; i++)
+    sum += total[i];
+
+  fflush(stdout);
+  fprintf(stderr, "\n%-16s %12s %10s %7s\n", "phase", "time (ms)", "entries", "%");
+  for (int i = 0; i < NumPhases; i++)
+    fprintf(stderr, "%-16s %12.3f %10d %6.1f%%\n", phaseNames[i],
+            total[i] * 1000, entries[i], sum > 0 ? 100 * total[i] / sum : 0.0);
+  fprintf(stderr, "%-16s %12.3f\n", "total", sum * 1000);
+}
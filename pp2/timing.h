@@ -0,0 +1,66 @@
+/* File: timing.h
+ * --------------
+ * This file defines a small timing class used to report how long each
+ * phase of the compiler takes. Timing is turned on with the "timing"
+ * debug key (dcc -d timing) and the summary is printed to stderr when
+ * the program exits.
+ *
+ * The phases are not cleanly separated in the code: the parser pulls
+ * tokens from the scanner on demand and nodes are built inside the
+ * parser actions. (The tree is printed once the parse is done, see
+ * main.cc.) So instead of timing phases end to end, the class keeps a stack of
+ * phases and charges elapsed time to whichever phase is on top. When
+ * the parser calls the scanner, the scan phase is pushed on top of the
+ * parse phase; when the scanner returns it is popped again. Each phase
+ * therefore reports its own (exclusive) time and the phases add up to
+ * the total.
+ */
+
+#ifndef _H_timing
+#define _H_timing
+
+typedef enum { PhaseScannerInit, PhaseParserInit, PhaseScan, PhaseParse,
+               PhaseBuild, PhasePrint, NumPhases } phaseT;
+
+class Timing
+{
+ public:
+
+  // Turns timing on if the "timing" debug key is set
+  static void Init();
+
+  // Returns true if timing has been turned on
+  static bool IsOn() { return on; }
+
+  // Start charging time to phase p, until the matching Pop()
+  static void Push(phaseT p) { if (on) Enter(p, true); }
+
+  // Stop charging time to the current phase, resume the one below it
+  static void Pop() { if (on) Leave(); }
+
+  // Replace the current phase with p (no-op if p is already current)
+  static void Switch(phaseT p) { if (on) Enter(p, false); }
+
+  // Returns a monotonic timestamp in seconds
+  static double Now();
+
+  // Prints the summary table to stderr (if timing is on)
+  static void PrintSummary();
+
+ private:
+
+  static const int MaxDepth = 16;
+
+  static void Enter(phaseT p, bool push);
+  static void Leave();
+  static void Charge();
+
+  static bool on;
+  static phaseT stack[MaxDepth];
+  static int depth;
+  static double last;
+  static double total[NumPhases];
+  static int entries[NumPhases];
+};
+
+#endif
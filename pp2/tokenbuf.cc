@@ -0,0 +1,258 @@
+/* File: tokenbuf.cc
+ * -----------------
+ * Implementation of the token buffer.
+ */
+
+#include "tokenbuf.h"
+#include "parser.h"
+#include "scanner.h"
+#include "sourcebuf.h"
+#include "memstats.h"
+#include <algorithm>
+
+static AllocBucket tokenArrays("token buffer", MemSourceLines);
+
+// Whether tokens of this kind have a value in the pool
+static inline bool HasValue(int kind)
+{
+  return kind == T_Identifier || kind == T_StringConstant ||
+         kind == T_IntConstant || kind == T_DoubleConstant ||
+         kind == T_BoolConstant;
+}
+
+template<class T> static size_t Bytes(const std::vector<T> &v)
+{
+  return v.capacity() * sizeof(T);
+}
+
+
+TokenBuffer::TokenBuffer()
+{
+  text = NULL;
+  next = 0;
+  nextValue = 0;
+}
+
+TokenBuffer::~TokenBuffer()
+{
+  if (MemStats::IsOn())
+    MemStats::Freed(&tokenArrays, ArraysSize());
+}
+
+size_t TokenBuffer::ArraysSize()
+{
+  size_t size = Bytes(kinds) + Bytes(starts) + Bytes(lengths) + Bytes(values);
+#ifndef COMPACT_LOCATIONS
+  size += Bytes(lines) + Bytes(columns);
+#endif
+  return size;
+}
+
+void TokenBuffer::Add(int token, const YYSTYPE &value, const yyltype &loc,
+                      size_t start)
+{
+  kinds.push_back(token);
+  starts.push_back(start);
+#ifdef COMPACT_LOCATIONS
+  lengths.push_back(loc.length);
+#else
+  lengths.push_back(loc.last_column - loc.first_column + 1);
+  lines.push_back(loc.first_line);
+  columns.push_back(loc.first_column);
+#endif
+  if (HasValue(token)) values.push_back(value);
+  if (token == T_StringConstant)
+    text = value.stringConstant.text - start;
+}
+
+TokenBuffer *TokenBuffer::Scan(Scanner *s)
+{
+  TokenBuffer *b = new TokenBuffer();
+  YYSTYPE value;
+  yyltype loc;
+  int token;
+  while ((token = ScanToken(s, &value, &loc)) != 0)
+    b->Add(token, value, loc, GetTokenStart(s));
+  if (MemStats::IsOn())
+    MemStats::Allocated(&tokenArrays, b->ArraysSize());
+  return b;
+}
+
+
+/* Rescanning after an edit
+ * ------------------------
+ * Where a token ends depends on a little of the text after it as well:
+ * the scanner looks at the next character to see that the token can't
+ * go on, and after 1. it looks as far as the e, the sign and the
+ * character after them to see whether an exponent follows. So a token
+ * that ends at least MaxLookahead characters before the edit is just
+ * as it was, as are those before it, and the scanner is started again
+ * just past the last such token, where it is between tokens and outside
+ * any comment. (Starting at the edit itself would be wrong if it were
+ * inside a comment, or a string, or a token.)
+ *
+ * From there the scanner goes through the edited source until a token
+ * it finds starts at or past the end of the inserted text, at the same
+ * column as an old token did where that one started (moved by the
+ * change in length). Both scans were then about to match a token in
+ * the normal state with the same text ahead, so from that token on the
+ * old ones are right but for their offsets and lines, and the tokens
+ * scanned before it replace the old ones from the restart up to it. An
+ * edit that opens a comment or a string is scanned on past until that
+ * is closed, or to the end of the text if it never is.
+ *
+ * The text outside that stretch isn't looked at again. What is left of
+ * the work goes over the arrays rather than the text: the tokens after
+ * it have their offsets (and lines) moved, the values before it are
+ * counted, and the arrays are moved along if the number of tokens
+ * changed.
+ */
+static const int MaxLookahead = 3;
+
+// Replaces v[from, to) with what is in with, moving what follows once
+template<class T> static void Splice(std::vector<T> &v, size_t from,
+                                     size_t to, const std::vector<T> &with)
+{
+  size_t n = with.size();
+  if (n > to - from)
+    v.insert(v.begin() + to, n - (to - from), T());
+  else
+    v.erase(v.begin() + from + n, v.begin() + to);
+  std::copy(with.begin(), with.end(), v.begin() + from);
+}
+
+template<class T> static void Shift(std::vector<T> &v, size_t from, long by)
+{
+  if (by == 0) return;
+  for (size_t i = from; i < v.size(); i++)
+    v[i] += by;
+}
+
+static size_t CountValues(const uint16_t *kinds, const uint16_t *end)
+{
+  size_t n = 0;
+  for (; kinds < end; kinds++)
+    n += HasValue(*kinds);
+  return n;
+}
+
+int TokenBuffer::Rescan(SourceBuffer *edited, const SourceEdit &edit)
+{
+  int numTokens = kinds.size();
+  long delta = (long)edit.insertedLength - (long)edit.removed;
+  size_t insertedEnd = edit.offset + edit.insertedLength;
+
+  // Ends of tokens only increase, so the ones to keep are found by
+  // bisection
+  int lo = 0, hi = numTokens;
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    if (starts[mid] + lengths[mid] + MaxLookahead <= edit.offset)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+  int first = lo;
+  size_t restart = 0;
+  int line = 1, column = 1;
+  if (first > 0) {
+    restart = starts[first-1] + lengths[first-1];
+#ifndef COMPACT_LOCATIONS
+    line = lines[first-1];
+    column = columns[first-1] + lengths[first-1];
+#endif
+  }
+
+  // The old tokens that new ones can line up with start past the edit
+  int old = std::lower_bound(starts.begin() + first, starts.end(),
+                             (uint32_t)(edit.offset + edit.removed))
+            - starts.begin();
+
+  TokenBuffer fresh;
+  Scanner *s = OpenScanner(edited, restart, line, column);
+  YYSTYPE value;
+  yyltype loc;
+  int token, scanned = 0;
+  long lineShift = 0;
+  bool synced = false;
+  while ((token = ScanToken(s, &value, &loc)) != 0) {
+    scanned++;
+    size_t start = GetTokenStart(s);
+    if (start >= insertedEnd) {
+      while (old < numTokens && (long)starts[old] + delta < (long)start)
+        old++;
+      if (old < numTokens && (long)starts[old] + delta == (long)start
+#ifndef COMPACT_LOCATIONS
+          && columns[old] == loc.first_column
+#endif
+          ) {
+#ifndef COMPACT_LOCATIONS
+        lineShift = loc.first_line - (long)lines[old];
+#endif
+        synced = true;
+        break;
+      }
+    }
+    fresh.Add(token, value, loc, start);
+  }
+  CloseScanner(s);
+  if (!synced) old = numTokens;
+
+  if (MemStats::IsOn()) {
+    MemStats::Freed(&tokenArrays, ArraysSize());
+    MemStats::Allocated(&tokenArrays, fresh.ArraysSize()); // see ~TokenBuffer
+  }
+  const uint16_t *k = kinds.data();
+  size_t firstValue = CountValues(k, k + first);
+  size_t oldValue = firstValue + CountValues(k + first, k + old);
+  Shift(starts, old, delta);
+#ifndef COMPACT_LOCATIONS
+  Shift(lines, old, lineShift);
+#endif
+  Splice(kinds, first, old, fresh.kinds);
+  Splice(starts, first, old, fresh.starts);
+  Splice(lengths, first, old, fresh.lengths);
+#ifndef COMPACT_LOCATIONS
+  Splice(lines, first, old, fresh.lines);
+  Splice(columns, first, old, fresh.columns);
+#endif
+  Splice(values, firstValue, oldValue, fresh.values);
+  text = edited->GetText();
+  if (MemStats::IsOn())
+    MemStats::Allocated(&tokenArrays, ArraysSize());
+  Rewind();
+  return scanned;
+}
+
+yyltype TokenBuffer::GetLocation(int i)
+{
+  yyltype loc = yyltype();
+#ifdef COMPACT_LOCATIONS
+  loc.offset = starts[i];
+  loc.length = lengths[i];
+#else
+  loc.first_line = loc.last_line = lines[i];
+  loc.first_column = columns[i];
+  loc.last_column = columns[i] + lengths[i] - 1;
+#endif
+  return loc;
+}
+
+int TokenBuffer::Next(YYSTYPE *value, yyltype *loc)
+{
+  if (next == (int)kinds.size()) return 0;
+  int i = next++;
+  int kind = kinds[i];
+#ifdef COMPACT_LOCATIONS
+  loc->offset = starts[i];
+  loc->length = lengths[i];
+#else
+  loc->first_line = lines[i];
+  loc->first_column = columns[i];
+  loc->last_column = columns[i] + lengths[i] - 1;
+#endif
+  if (HasValue(kind)) *value = values[nextValue++];
+  if (kind == T_StringConstant)
+    value->stringConstant.text = text + starts[i];
+  return kind;
+}
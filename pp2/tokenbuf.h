@@ -0,0 +1,89 @@
+/* File: tokenbuf.h
+ * ----------------
+ * This file defines a buffer that holds every token of an input, so the
+ * whole input can be scanned in one go before parsing starts. This is
+ * what the "pretok" debug key selects (dcc -d pretok): the scanner runs
+ * its loop over the whole input with nothing else in the cache, the
+ * scan and the parse can be timed apart, and the tokens can be gone
+ * over again without scanning again.
+ *
+ * The tokens are kept as a struct of arrays: one array each of token
+ * codes, start offsets, lengths, lines and columns, indexed by token
+ * number, plus a pool holding the values of just those tokens that
+ * carry one (identifiers and constants), in order. (A string
+ * constant's span is made again from the token's offset and length
+ * when it is read, so that it is into the source the buffer was last
+ * brought up to date with.) The arrays are
+ * packed tightly (a token code fits in 16 bits), and reading them in
+ * order goes straight through memory. With compact locations (see
+ * location.h) the start and length are the whole location, and there
+ * are no line and column arrays.
+ *
+ * Since the scanner runs to the end before the parser starts, every
+ * lexical error in the input is reported before any syntax error, where
+ * otherwise they come out in the order they are found and a syntax
+ * error stops the compile first.
+ *
+ * After an edit to the source, Rescan brings the buffer up to date by
+ * scanning only the part of the edited source around the edit, for an
+ * editor that has the compiler look at its text again after every
+ * change (see tokenbuf.cc).
+ */
+
+#ifndef _H_tokenbuf
+#define _H_tokenbuf
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+#include "location.h"
+
+struct Scanner;
+union YYSTYPE;
+class SourceBuffer;
+struct SourceEdit;
+
+class TokenBuffer
+{
+ public:
+  // Scans everything left in s into a new buffer
+  static TokenBuffer *Scan(Scanner *s);
+
+  ~TokenBuffer();
+
+  // Brings the buffer up to date with an edit to the source its tokens
+  // were scanned from: edited is what Edit(edit) on that source made of
+  // it. Lexical errors in the part scanned again are reported again.
+  // Returns the number of tokens scanned.
+  int Rescan(SourceBuffer *edited, const SourceEdit &edit);
+
+  int NumTokens()             { return kinds.size(); }
+  int GetKind(int i)          { return kinds[i]; }
+  uint32_t GetStart(int i)    { return starts[i]; }   // offset in the source
+  uint32_t GetLength(int i)   { return lengths[i]; }
+  yyltype GetLocation(int i);
+
+  // Returns the next token in order, with its value and location, as
+  // yylex does, or 0 after the last one
+  int Next(YYSTYPE *value, yyltype *loc);
+
+  // Starts reading from the first token again
+  void Rewind() { next = 0; nextValue = 0; }
+
+ private:
+  TokenBuffer();
+  size_t ArraysSize();     // bytes taken by the arrays, for -d mem
+  void Add(int token, const YYSTYPE &value, const yyltype &loc, size_t start);
+
+  std::vector<uint16_t> kinds;
+  std::vector<uint32_t> starts, lengths;
+#ifndef COMPACT_LOCATIONS
+  std::vector<uint32_t> lines, columns;
+#endif
+  std::vector<YYSTYPE> values;
+  const char *text;        // of the source, for string constants
+  int next;
+  size_t nextValue;
+};
+
+#endif
@@ -0,0 +1,120 @@
+#!/usr/bin/env python3
+# File: bench.py
+# --------------
+# Runs dcc over a set of Decaf sources and reports throughput. For each
+# file we report its size, the number of tokens in it, the number of AST
+# nodes dcc printed, the best wall time over --repeat runs, and the
+# derived bytes/sec, tokens/sec and nodes/sec.
+#
+# Tokens are counted here with a regular expression that mirrors the
+# definitions in scanner.l, so the count does not depend on anything dcc
+# reports. Nodes are counted from dcc's output: Node::Print starts every
+# node on a fresh line and Program::PrintChildren adds one trailing
+# newline, so a tree with N nodes prints N+1 newlines. Files with errors
+# print no tree and report 0 nodes.
+#
+#   bench.py --dcc ./dcc samples/*.decaf bench/*.decaf
+#
+# Pass --args "-d lexonly" to time the scanner on its own; the node
+# counts are then 0 since no tree is built. With --file, dcc is given the
+# file name (and maps the file) instead of reading it from stdin.
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+import time
+
+TOKEN_RE = re.compile(rb"""
+    (?P<skip> [ \t\r\n]+ | //[^\n]* | /\*.*?\*/ )
+  | (?P<tok>  [0-9]+\.[0-9]*(?:[Ee][-+]?[0-9]+)?
+            | 0[Xx][0-9a-fA-F]+
+            | [0-9]+
+            | "[^"\n]*"?
+            | [a-zA-Z][a-zA-Z_0-9]*
+            | \+\+ | -- | <= | >= | == | != | && | \|\| | \[\]
+            | . )
+""", re.VERBOSE | re.DOTALL)
+
+
+def count_tokens(data):
+    n = 0
+    for m in TOKEN_RE.finditer(data):
+        if m.lastgroup == "tok":
+            n += 1
+    return n
+
+
+def run_once(cmd, path, by_name):
+    with open(path, "rb") as src:
+        if by_name:
+            cmd = cmd[:1] + [path] + cmd[1:]
+        start = time.perf_counter()
+        proc = subprocess.run(cmd, stdin=None if by_name else src,
+                              stdout=subprocess.PIPE,
+                              stderr=subprocess.DEVNULL)
+        elapsed = time.perf_counter() - start
+    return elapsed, proc.returncode, proc.stdout
+
+
+def rate(count, seconds):
+    return count / seconds if seconds > 0 else 0.0
+
+
+def human(n):
+    for unit in ["", "K", "M", "G"]:
+        if abs(n) < 1000:
+            return "%.1f%s" % (n, unit)
+        n /= 1000.0
+    return "%.1fT" % n
+
+
+def main():
+    p = argparse.ArgumentParser(description="Measure dcc throughput.")
+    p.add_argument("--dcc", default="./dcc", help="path to the compiler")
+    p.add_argument("--args", default="",
+                   help="extra arguments for dcc, e.g. \"-d lexonly\"")
+    p.add_argument("--file", action="store_true",
+                   help="pass each file to dcc by name instead of on stdin")
+    p.add_argument("--repeat", type=int, default=3,
+                   help="runs per file; the fastest one is reported")
+    p.add_argument("files", nargs="+")
+    args = p.parse_args()
+
+    header = "%-28s %9s %9s %9s %9s %10s %10s %10s %4s" % (
+        "file", "bytes", "tokens", "nodes", "wall ms",
+        "bytes/s", "tokens/s", "nodes/s", "rc")
+    print(header)
+    print("-" * len(header))
+
+    cmd = [args.dcc] + args.args.split()
+    totals = [0, 0, 0, 0.0]
+    for path in args.files:
+        with open(path, "rb") as f:
+            data = f.read()
+        tokens = count_tokens(data)
+        best, rc, out = None, 0, b""
+        for _ in range(max(1, args.repeat)):
+            elapsed, rc, out = run_once(cmd, path, args.file)
+            if best is None or elapsed < best:
+                best = elapsed
+        nodes = max(0, out.count(b"\n") - 1) if rc == 0 else 0
+        print("%-28s %9d %9d %9d %9.2f %10s %10s %10s %4d" % (
+            os.path.basename(path)[-28:], len(data), tokens, nodes,
+            best * 1000, human(rate(len(data), best)),
+            human(rate(tokens, best)), human(rate(nodes, best)), rc))
+        totals[0] += len(data)
+        totals[1] += tokens
+        totals[2] += nodes
+        totals[3] += best
+
+    print("-" * len(header))
+    print("%-28s %9d %9d %9d %9.2f %10s %10s %10s" % (
+        "total", totals[0], totals[1], totals[2], totals[3] * 1000,
+        human(rate(totals[0], totals[3])), human(rate(totals[1], totals[3])),
+        human(rate(totals[2], totals[3]))))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,148 @@
+#!/usr/bin/env python3
+# File: check.py
+# --------------
+# Runs dcc on each sample and compares what it prints (stdout and stderr
+# together, as the .out files were made) against the matching .out file
+# byte for byte. Along the way it records the best wall time and the peak
+# RSS of each run and writes them to a JSON results file. The peak RSS
+# comes from dcc itself (dcc -d peakrss): the kernel's figure for a child
+# of this script would include the memory of the forked Python process,
+# which is larger than dcc needs for any of the samples.
+#
+# If a baseline (a results file saved from an earlier run) is given, each
+# sample's time and memory are compared against it, and anything that got
+# slower or bigger beyond the tolerances is reported as a regression.
+# Times for tiny inputs are dominated by process startup, so a sample
+# only counts as slower if it exceeds both the relative tolerance and an
+# absolute one. Baselines are made on the machine they are compared on
+# (make baseline) and are not checked in.
+#
+# Samples named with --xfail are expected not to match (e.g. switch.decaf,
+# whose construct the grammar does not handle yet). The exit status is 1
+# if any other sample fails or anything regressed, and 0 otherwise.
+#
+#   check.py --dcc ./dcc --results check-results.json \
+#            --baseline check-baseline.json samples/*.decaf
+
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+import time
+
+
+PEAK_RE = re.compile(rb"peak RSS: (-?\d+) KB\n")
+
+
+def run_once(cmd, path):
+    """Runs cmd on path; returns (output, exit status, seconds)."""
+    with open(path, "rb") as src:
+        start = time.perf_counter()
+        proc = subprocess.run(cmd, stdin=src, stdout=subprocess.PIPE,
+                              stderr=subprocess.STDOUT)
+        elapsed = time.perf_counter() - start
+    return proc.stdout, proc.returncode, elapsed
+
+
+def check_sample(dcc, path, repeat):
+    # The output is checked from a plain run; the timed runs also ask for
+    # the peak RSS, which dcc prints on stderr just before exiting.
+    out, rc, _ = run_once([dcc], path)
+    best_time, peak = None, 0
+    for _ in range(max(1, repeat)):
+        timed, _, elapsed = run_once([dcc, "-d", "peakrss"], path)
+        if best_time is None or elapsed < best_time:
+            best_time = elapsed
+        m = PEAK_RE.search(timed)
+        if m:
+            peak = max(peak, int(m.group(1)))
+
+    expected = os.path.splitext(path)[0] + ".out"
+    if not os.path.exists(expected):
+        status = "nogold"
+    else:
+        with open(expected, "rb") as f:
+            status = "pass" if f.read() == out else "fail"
+    return {"status": status, "exit": rc, "seconds": best_time,
+            "maxrss_kb": peak}
+
+
+def compare(name, result, base, args):
+    """Returns a list of regression messages for one sample."""
+    problems = []
+    t, bt = result["seconds"], base["seconds"]
+    if t > bt * (1 + args.time_tolerance) and t - bt > args.time_slack:
+        problems.append("%s: time %.2fms, baseline %.2fms"
+                        % (name, t * 1000, bt * 1000))
+    m, bm = result["maxrss_kb"], base["maxrss_kb"]
+    if m > bm * (1 + args.mem_tolerance) and m - bm > args.mem_slack:
+        problems.append("%s: peak RSS %dKB, baseline %dKB" % (name, m, bm))
+    if base.get("status") == "pass" and result["status"] != "pass":
+        problems.append("%s: passed in baseline, now %s"
+                        % (name, result["status"]))
+    return problems
+
+
+def main():
+    p = argparse.ArgumentParser(description="Check dcc against sample outputs.")
+    p.add_argument("--dcc", default="./dcc", help="path to the compiler")
+    p.add_argument("--repeat", type=int, default=5,
+                   help="runs per sample; the fastest time is recorded")
+    p.add_argument("--results", default="check-results.json",
+                   help="where to write the results")
+    p.add_argument("--baseline", help="results file to compare against")
+    p.add_argument("--xfail", action="append", default=[],
+                   help="sample expected to fail (file name, repeatable)")
+    p.add_argument("--time-tolerance", type=float, default=0.25,
+                   help="allowed relative slowdown (default 0.25 = 25%%)")
+    p.add_argument("--time-slack", type=float, default=0.002,
+                   help="slowdowns under this many seconds are ignored")
+    p.add_argument("--mem-tolerance", type=float, default=0.10,
+                   help="allowed relative growth in peak RSS")
+    p.add_argument("--mem-slack", type=int, default=256,
+                   help="growth under this many KB is ignored")
+    p.add_argument("samples", nargs="+")
+    args = p.parse_args()
+
+    results = {}
+    failures = 0
+    for path in args.samples:
+        name = os.path.basename(path)
+        r = check_sample(args.dcc, path, args.repeat)
+        results[name] = r
+        status = r["status"]
+        if name in args.xfail:
+            status = "xpass" if status == "pass" else "xfail"
+        elif status == "fail":
+            failures += 1
+        print("%-6s %-24s %8.2fms %8dKB" % (status.upper(), name,
+                                            r["seconds"] * 1000, r["maxrss_kb"]))
+
+    with open(args.results, "w") as f:
+        json.dump(results, f, indent=2, sort_keys=True)
+        f.write("\n")
+
+    regressions = []
+    if args.baseline:
+        if not os.path.exists(args.baseline):
+            print("no baseline at %s; save one with 'make baseline'"
+                  % args.baseline)
+        else:
+            with open(args.baseline) as f:
+                baseline = json.load(f)
+            for name in sorted(results):
+                if name in baseline:
+                    regressions += compare(name, results[name],
+                                           baseline[name], args)
+    for msg in regressions:
+        print("REGRESSION " + msg)
+
+    print("%d samples, %d failed, %d regressions; results in %s"
+          % (len(results), failures, len(regressions), args.results))
+    sys.exit(1 if failures or regressions else 0)
+
+
+if __name__ == "__main__":
+    main()
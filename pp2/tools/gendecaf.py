@@ -0,0 +1,289 @@
+#!/usr/bin/env python3
+# File: gendecaf.py
+# -----------------
+# Generates large, syntactically valid Decaf programs for benchmarking
+# dcc. The output only has to get through the pp2 parser, so names are
+# never checked against declarations, but every construct emitted is
+# accepted by the grammar in parser.y (binary operands are parenthesized
+# so the nonassoc operators never chain, assignments only appear at
+# statement level, and so on).
+#
+# The mix of top-level declarations and the density of statements and
+# expressions can be tuned independently:
+#
+#   gendecaf.py --kb 2560 -o big.decaf              # ~2.5MB, default mix
+#   gendecaf.py --kb 512 --classes 0 --interfaces 0 # functions only
+#   gendecaf.py --kb 512 --stmts 40 --expr-depth 6  # expression heavy
+#
+# The --classes/--interfaces/--functions weights pick what kind of
+# top-level declaration comes next; generation stops once the program
+# reaches the requested size. The same --seed always produces the same
+# program.
+
+import argparse
+import random
+import sys
+
+BASE_TYPES = ["int", "double", "bool", "string"]
+ARITH_OPS = ["+", "-", "*", "/", "%"]
+REL_OPS = ["<", "<=", ">", ">="]
+EQ_OPS = ["==", "!="]
+LOGIC_OPS = ["&&", "||"]
+
+
+class Generator:
+    def __init__(self, args):
+        self.rng = random.Random(args.seed)
+        self.args = args
+        self.out = []
+        self.size = 0
+        self.counter = 0
+        self.classes = []
+        self.interfaces = []
+
+    def emit(self, text):
+        self.out.append(text)
+        self.size += len(text)
+
+    def fresh(self, prefix):
+        self.counter += 1
+        return "%s%d" % (prefix, self.counter)
+
+    # ------------------------------------------------------------ names
+    def var_name(self):
+        return self.rng.choice(["a", "b", "i", "j", "k", "n", "sum",
+                                "count", "total", "value", "idx",
+                                "result", "tmp", "flag"])
+
+    def type_name(self, allow_named=True):
+        r = self.rng.random()
+        if allow_named and self.classes and r < 0.15:
+            t = self.rng.choice(self.classes)
+        else:
+            t = self.rng.choice(BASE_TYPES)
+        if self.rng.random() < 0.1:
+            t += "[]"
+        return t
+
+    # ------------------------------------------------------ expressions
+    def constant(self):
+        r = self.rng.randrange(7)
+        if r == 0:
+            return str(self.rng.randrange(100000))
+        if r == 1:
+            return "0x%X" % self.rng.randrange(65536)
+        if r == 2:
+            return "%d.%d" % (self.rng.randrange(1000), self.rng.randrange(100))
+        if r == 3:
+            return "%d.%dE%d" % (self.rng.randrange(10), self.rng.randrange(10),
+                                 self.rng.randrange(1, 20))
+        if r == 4:
+            return self.rng.choice(["true", "false"])
+        if r == 5:
+            return '"%s"' % self.rng.choice(["hello", "x = ", "\\t", "done",
+                                             "matrix row", ""])
+        return "null"
+
+    def lvalue(self, depth):
+        r = self.rng.randrange(4)
+        if r == 0 and depth > 0:
+            return "%s[%s]" % (self.var_name(), self.expr(depth - 1))
+        if r == 1:
+            return "%s.%s" % (self.rng.choice(["this", self.var_name()]),
+                              self.var_name())
+        return self.var_name()
+
+    def call(self, depth):
+        nargs = self.rng.randrange(4)
+        actuals = ", ".join(self.expr(depth - 1) for _ in range(nargs))
+        name = self.fresh_call_name()
+        if self.rng.random() < 0.4:
+            return "%s.%s(%s)" % (self.var_name(), name, actuals)
+        return "%s(%s)" % (name, actuals)
+
+    def fresh_call_name(self):
+        return self.rng.choice(["Get", "Set", "Init", "Find", "Compute",
+                                "Update", "PrintMatrix", "GetNext"])
+
+    def leaf(self):
+        r = self.rng.random()
+        if r < 0.45:
+            return self.var_name()
+        if r < 0.9:
+            return self.constant()
+        if r < 0.95:
+            return "this"
+        return self.rng.choice(["ReadInteger()", "ReadLine()"])
+
+    def expr(self, depth):
+        if depth <= 0 or self.rng.random() < 0.25:
+            return self.leaf()
+        r = self.rng.random()
+        if r < 0.45:
+            op = self.rng.choice(ARITH_OPS + REL_OPS + EQ_OPS + LOGIC_OPS)
+            return "(%s %s %s)" % (self.expr(depth - 1), op,
+                                   self.expr(depth - 1))
+        if r < 0.55:
+            return "%s%s" % (self.rng.choice(["-", "!"]),
+                             self.wrap(self.expr(depth - 1)))
+        if r < 0.7:
+            return self.call(depth)
+        if r < 0.8:
+            return self.lvalue(depth)
+        if r < 0.85 and self.classes:
+            return "New(%s)" % self.rng.choice(self.classes)
+        if r < 0.9:
+            return "NewArray(%s, %s)" % (self.expr(depth - 1),
+                                         self.type_name())
+        return self.leaf()
+
+    def wrap(self, e):
+        return e if e.startswith("(") else "(%s)" % e
+
+    # ------------------------------------------------------- statements
+    def stmt(self, indent, depth, in_loop):
+        pad = "  " * indent
+        d = self.args.expr_depth
+        r = self.rng.random()
+        if depth <= 0 or r < 0.35:
+            return "%s%s = %s;\n" % (pad, self.lvalue(d), self.expr(d))
+        if r < 0.45:
+            return "%s%s;\n" % (pad, self.call(d))
+        if r < 0.5:
+            return "%s%s%s;\n" % (pad, self.var_name(),
+                                  self.rng.choice(["++", "--"]))
+        if r < 0.58:
+            return "%sPrint(%s);\n" % (pad, ", ".join(
+                self.expr(d) for _ in range(self.rng.randrange(1, 4))))
+        if r < 0.68:
+            s = "%sif (%s)\n%s" % (pad, self.expr(d),
+                                   self.block(indent, depth - 1, in_loop))
+            if self.rng.random() < 0.5:
+                s += "%selse\n%s" % (pad, self.block(indent, depth - 1,
+                                                      in_loop))
+            return s
+        if r < 0.76:
+            return "%swhile (%s)\n%s" % (pad, self.expr(d),
+                                         self.block(indent, depth - 1, True))
+        if r < 0.84:
+            init = self.rng.choice(["", "i = 0"])
+            step = self.rng.choice(["", "i = i + 1", "i++"])
+            return "%sfor (%s; %s; %s)\n%s" % (pad, init, self.expr(d), step,
+                                               self.block(indent, depth - 1,
+                                                          True))
+        if r < 0.88 and in_loop:
+            return "%sbreak;\n" % pad
+        if r < 0.93:
+            e = self.expr(d) if self.rng.random() < 0.8 else ""
+            return "%sreturn%s;\n" % (pad, " " + e if e else "")
+        return self.block(indent, depth - 1, in_loop)
+
+    def block(self, indent, depth, in_loop):
+        pad = "  " * indent
+        s = pad + "{\n"
+        for _ in range(self.rng.randrange(3)):
+            s += "%s  %s %s;\n" % (pad, self.type_name(), self.var_name())
+        for _ in range(self.rng.randrange(1, 4)):
+            s += self.stmt(indent + 1, depth, in_loop)
+        return s + pad + "}\n"
+
+    # ----------------------------------------------------- declarations
+    def formals(self):
+        return ", ".join("%s %s" % (self.type_name(), self.var_name())
+                         for _ in range(self.rng.randrange(4)))
+
+    def fn_header(self, name):
+        ret = self.rng.choice(["void"] + [self.type_name()] * 3)
+        return "%s %s(%s)" % (ret, name, self.formals())
+
+    def fn_decl(self, indent, name):
+        pad = "  " * indent
+        s = "%s%s {\n" % (pad, self.fn_header(name))
+        for _ in range(self.rng.randrange(4)):
+            s += "%s  %s %s;\n" % (pad, self.type_name(), self.var_name())
+        for _ in range(self.rng.randrange(1, self.args.stmts + 1)):
+            s += self.stmt(indent + 1, self.args.nesting, False)
+        return s + pad + "}\n"
+
+    def interface_decl(self):
+        name = self.fresh("Iface")
+        s = "interface %s {\n" % name
+        for _ in range(self.rng.randrange(1, 6)):
+            s += "  %s;\n" % self.fn_header(self.fresh("Op"))
+        self.interfaces.append(name)
+        return s + "}\n\n"
+
+    def class_decl(self):
+        name = self.fresh("Class")
+        s = "class %s" % name
+        if self.classes and self.rng.random() < 0.5:
+            s += " extends %s" % self.rng.choice(self.classes)
+        if self.interfaces and self.rng.random() < 0.5:
+            n = self.rng.randrange(1, min(3, len(self.interfaces)) + 1)
+            s += " implements %s" % ", ".join(
+                self.rng.sample(self.interfaces, n))
+        s += " {\n"
+        for _ in range(self.rng.randrange(1, 5)):
+            s += "  %s %s;\n" % (self.type_name(), self.fresh("field"))
+        for _ in range(self.rng.randrange(1, self.args.methods + 1)):
+            s += self.fn_decl(1, self.fresh("Method"))
+        self.classes.append(name)
+        return s + "}\n\n"
+
+    def generate(self):
+        a = self.args
+        kinds = ["class", "interface", "function", "global"]
+        weights = [a.classes, a.interfaces, a.functions, a.globals]
+        if sum(weights) <= 0:
+            sys.exit("gendecaf: at least one declaration weight must be > 0")
+        target = a.kb * 1024
+        self.emit("// Generated by gendecaf.py --seed %d --kb %d\n\n"
+                  % (a.seed, a.kb))
+        while self.size < target:
+            kind = self.rng.choices(kinds, weights)[0]
+            if kind == "class":
+                self.emit(self.class_decl())
+            elif kind == "interface":
+                self.emit(self.interface_decl())
+            elif kind == "function":
+                self.emit(self.fn_decl(0, self.fresh("Func")) + "\n")
+            else:
+                self.emit("%s %s;\n" % (self.type_name(), self.fresh("global")))
+        self.emit("void main() {\n  Print(\"done\");\n}\n")
+        return "".join(self.out)
+
+
+def main():
+    p = argparse.ArgumentParser(description="Generate a large valid Decaf program.")
+    p.add_argument("--kb", type=int, default=256,
+                   help="approximate size of the output in kilobytes")
+    p.add_argument("--seed", type=int, default=1)
+    p.add_argument("--classes", type=float, default=3,
+                   help="relative weight of class declarations")
+    p.add_argument("--interfaces", type=float, default=1,
+                   help="relative weight of interface declarations")
+    p.add_argument("--functions", type=float, default=4,
+                   help="relative weight of global function declarations")
+    p.add_argument("--globals", type=float, default=1,
+                   help="relative weight of global variable declarations")
+    p.add_argument("--methods", type=int, default=5,
+                   help="maximum methods per class")
+    p.add_argument("--stmts", type=int, default=8,
+                   help="maximum top-level statements per function body")
+    p.add_argument("--nesting", type=int, default=3,
+                   help="maximum statement nesting depth")
+    p.add_argument("--expr-depth", type=int, default=3,
+                   help="maximum expression tree depth")
+    p.add_argument("-o", "--output", help="output file (default stdout)")
+    args = p.parse_args()
+
+    text = Generator(args).generate()
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,70 @@
+#!/usr/bin/env python3
+# File: gendeep.py
+# ----------------
+# Generates Decaf programs that nest one construct to a given depth, to
+# find how deep dcc can go before it fails. Each program is one function
+# whose body holds the nested construct:
+#
+#   chain    x = a + a + ... + a;        (depth terms; '+' is left
+#                                         associative, so the parse stack
+#                                         stays flat but the tree is
+#                                         depth levels deep)
+#   parens   x = ((...(a)...));          (depth parentheses; both the
+#                                         parse stack and the tree grow)
+#   unary    x = - - ... - a;            (depth unary minuses)
+#   if       if (a) { if (a) { ... } }   (depth nested IfStmts, each with
+#                                         a StmtBlock body)
+#   block    { { ... { x = a; } ... } }  (depth nested StmtBlocks)
+#
+#   gendeep.py --shape parens --depth 20000 -o deep.decaf
+#
+# tools/stress.py uses this to run dcc at growing depths.
+
+import argparse
+import sys
+
+SHAPES = ["chain", "parens", "unary", "if", "block"]
+
+
+def body(shape, depth):
+    """Returns the statement(s) for one nested construct."""
+    if shape == "chain":
+        return "x = " + " + ".join(["a"] * depth) + ";\n"
+    if shape == "parens":
+        return "x = " + "(" * depth + "a" + ")" * depth + ";\n"
+    if shape == "unary":
+        return "x = " + "- " * depth + "a;\n"
+    if shape == "if":
+        return "if (a) {\n" * depth + "x = a;\n" + "}\n" * depth
+    if shape == "block":
+        return "{\n" * depth + "x = a;\n" + "}\n" * depth
+    raise ValueError("unknown shape %s" % shape)
+
+
+def generate(shape, depth):
+    return ("void main() {\n"
+            "int a;\n"
+            "int x;\n"
+            + body(shape, max(1, depth)) +
+            "}\n")
+
+
+def main():
+    p = argparse.ArgumentParser(description="Generate a deeply nested Decaf program.")
+    p.add_argument("--shape", choices=SHAPES, default="chain",
+                   help="what to nest (default chain)")
+    p.add_argument("--depth", type=int, default=1000,
+                   help="how deep to nest it")
+    p.add_argument("-o", "--output", help="output file (default stdout)")
+    args = p.parse_args()
+
+    text = generate(args.shape, args.depth)
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(text)
+    else:
+        sys.stdout.write(text)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,51 @@
+#!/usr/bin/env python3
+# File: kwhash.py
+# ---------------
+# Finds multipliers for KeywordHash in keywords.h, which must send every
+# keyword to a different slot of the table:
+#
+#   (first char + B * last char + C * length) & (slots - 1)
+#
+# Run it with the keyword list from keywords.h if the static_assert
+# there fails after adding a keyword; it prints the smallest B and C
+# that work for the smallest table size it can.
+#
+#   kwhash.py void int double ... ReadLine true false
+
+import argparse
+import sys
+
+
+def slot(word, b, c, slots):
+    return (ord(word[0]) + b * ord(word[-1]) + c * len(word)) & (slots - 1)
+
+
+def search(words, slots, limit):
+    for b in range(limit):
+        for c in range(limit):
+            if len(set(slot(w, b, c, slots) for w in words)) == len(words):
+                return b, c
+    return None
+
+
+def main():
+    p = argparse.ArgumentParser(description="Find a perfect hash for keywords.")
+    p.add_argument("--limit", type=int, default=64,
+                   help="largest multiplier to try")
+    p.add_argument("words", nargs="+")
+    args = p.parse_args()
+
+    slots = 1
+    while slots < len(args.words):
+        slots *= 2
+    while slots <= 1024:
+        found = search(args.words, slots, args.limit)
+        if found:
+            print("slots %d: B = %d, C = %d" % ((slots,) + found))
+            return
+        slots *= 2
+    sys.exit("no perfect hash found; try a larger --limit")
+
+
+if __name__ == "__main__":
+    main()
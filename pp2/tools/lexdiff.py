@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+# File: lexdiff.py
+# ----------------
+# Differential test of two builds of dcc that differ only in their
+# scanner (the flex one and the hand-written one, see SCANNER in the
+# Makefile). Each file is run through both builds twice: once with
+# "-d lexonly -d tokens", which dumps every token with its location and
+# value, and once as a plain compile. stdout and stderr are compared
+# together, along with the exit status, and the first difference in each
+# file is shown.
+#
+# Besides the files given, --fuzz N makes N small random inputs out of
+# the fragments that the scanner's longest-match rules have to get right
+# (0x with and without hex digits, doubles with and without exponents,
+# unterminated strings and comments, tabs in and out of comments, lone &
+# and |, characters that start no token, and so on) and checks those
+# too; --seed makes the run repeatable. A failing input is kept in
+# --keep (lexdiff-fail-N.decaf by default) so it can be rerun by hand.
+#
+# With --speed, the scanner-only time of both builds (the best of
+# --repeat runs) is reported as well, summed over the files. flex's
+# speed depends on its table layout, so the reference is labelled with
+# the options given in --tables (the Makefile passes LEXTABLES); compare
+# speeds only between runs with the same layout.
+#
+#   lexdiff.py --reference variants/dcc-flex --candidate variants/dcc-hand \
+#              --fuzz 200 samples/*.decaf
+
+import argparse
+import os
+import random
+import subprocess
+import sys
+import tempfile
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from bench import human, rate, run_once
+
+
+MODES = [("tokens", ["-d", "lexonly", "-d", "tokens"]), ("compile", [])]
+
+FRAGMENTS = [
+    "0", "00", "0x", "0X", "0x1F", "0xg", "007", "12", "1.", "1.5", ".5",
+    "1.5e", "1.5E+", "1.5e-3", "1e5", "1.e5", "3.14E10", "x", "X1", "_a",
+    "a_b", "int", "intx", "true", "false", "truex", "null", "NewArray",
+    "aVeryLongIdentifierThatGoesOnPastThirtyOneCharacters", "\"s\"",
+    "\"unterminated", "\"\"", "/*", "*/", "/* c */", "/**/", "/*/", "//",
+    "// line", "*", "/", "+", "++", "+++", "-", "--", "<", "<=", "<<", ">",
+    ">=", "=", "==", "===", "!", "!=", "&", "&&", "|", "||", "[", "]", "[]",
+    "[ ]", "(", ")", "{", "}", ";", ",", ".", "%", "#", "@", "$", "\\", "'",
+    "?", ":", "~", "^", "\r", "\x00", "\x80", "\xff", " ", "  ", "\t",
+    "\t\t", "\n", "\n\n", " \t ",
+]
+
+
+def run(cmd, path):
+    """Returns (exit status, stdout and stderr together) for cmd on path."""
+    with open(path, "rb") as src:
+        proc = subprocess.run(cmd, stdin=src, stdout=subprocess.PIPE,
+                              stderr=subprocess.STDOUT)
+    return proc.returncode, proc.stdout
+
+
+def first_difference(a, b):
+    """Returns (line number, line of a, line of b) where a and b differ."""
+    la, lb = a.split(b"\n"), b.split(b"\n")
+    for i in range(max(len(la), len(lb))):
+        x = la[i] if i < len(la) else b"<end>"
+        y = lb[i] if i < len(lb) else b"<end>"
+        if x != y:
+            return i + 1, x, y
+    return 0, b"", b""
+
+
+def compare(args, path, name):
+    """Runs both builds on path in each mode; returns the differences."""
+    problems = []
+    for mode, flags in MODES:
+        ref = run([args.reference] + flags, path)
+        cand = run([args.candidate] + flags, path)
+        if ref == cand:
+            continue
+        if ref[0] != cand[0]:
+            problems.append("%s (%s): exit status %d vs %d"
+                            % (name, mode, ref[0], cand[0]))
+        if ref[1] != cand[1]:
+            line, x, y = first_difference(ref[1], cand[1])
+            problems.append("%s (%s): line %d\n  reference: %r\n  candidate: %r"
+                            % (name, mode, line, x, y))
+    return problems
+
+
+def fuzz_input(rng, size):
+    return "".join(rng.choice(FRAGMENTS) for _ in range(size)).encode("latin-1")
+
+
+def scan_time(dcc, paths, repeat):
+    total = 0.0
+    for path in paths:
+        best = None
+        for _ in range(max(1, repeat)):
+            elapsed, _, _ = run_once([dcc, "-d", "lexonly"], path, False)
+            if best is None or elapsed < best:
+                best = elapsed
+        total += best
+    return total
+
+
+def main():
+    p = argparse.ArgumentParser(description="Compare two dcc scanners.")
+    p.add_argument("--reference", required=True, help="dcc with the flex scanner")
+    p.add_argument("--candidate", required=True, help="dcc with the other scanner")
+    p.add_argument("--fuzz", type=int, default=0,
+                   help="number of random inputs to check as well")
+    p.add_argument("--seed", type=int, default=1, help="seed for --fuzz")
+    p.add_argument("--keep", default="lexdiff-fail-%d.decaf",
+                   help="where to save failing random inputs")
+    p.add_argument("--speed", action="store_true",
+                   help="also compare the scanners' speed")
+    p.add_argument("--repeat", type=int, default=3,
+                   help="runs per file for --speed; the fastest counts")
+    p.add_argument("--tables", default="unknown",
+                   help="flex table options the reference was built with")
+    p.add_argument("files", nargs="*")
+    args = p.parse_args()
+
+    problems = []
+    for path in args.files:
+        problems += compare(args, path, os.path.basename(path))
+
+    rng = random.Random(args.seed)
+    failed = 0
+    with tempfile.TemporaryDirectory() as tmp:
+        path = os.path.join(tmp, "fuzz.decaf")
+        for i in range(args.fuzz):
+            data = fuzz_input(rng, rng.randint(1, 40))
+            with open(path, "wb") as f:
+                f.write(data)
+            found = compare(args, path, "fuzz %d" % i)
+            if found:
+                failed += 1
+                kept = args.keep % i if "%" in args.keep else args.keep
+                with open(kept, "wb") as f:
+                    f.write(data)
+                problems += found + ["  (input saved in %s)" % kept]
+
+    for msg in problems:
+        print(msg)
+
+    if args.speed and args.files:
+        size = sum(os.path.getsize(f) for f in args.files)
+        for label, dcc in [("reference", args.reference),
+                           ("candidate", args.candidate)]:
+            seconds = scan_time(dcc, args.files, args.repeat)
+            print("%-10s scan %8.2fms %8sB/s" % (label, seconds * 1000,
+                                                 human(rate(size, seconds))))
+        print("reference built with flex %s" % args.tables)
+
+    print("%d files, %d random inputs (%d differ); %s"
+          % (len(args.files), args.fuzz, failed,
+             "scanners differ" if problems else "scanners agree"))
+    sys.exit(1 if problems else 0)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+# File: lexvariants.py
+# --------------------
+# Compares builds of dcc that differ only in how flex laid out the
+# scanner's tables (see LEXTABLES in the Makefile). For each build it
+# reports the size of the executable and of its scanner object file (as
+# size(1) counts it, so the read-only tables are part of "text"), and
+# the throughput, summed over all the given files, of the scanner alone
+# (dcc -d lexonly) and of a full parse. Files with errors are skipped for
+# the full parse. The scanner object is found next to the executable,
+# named as the Makefile names it (dcc-Cf goes with lex-Cf.yy.o). The
+# last line names the variant whose scanner alone was fastest. With
+# --save FILE, it also writes that variant to FILE as a make assignment
+# (LEXTABLES = -Cf), which the Makefile reads as its default.
+#
+#   lexvariants.py --variant Cf=variants/dcc-Cf --variant CF=variants/dcc-CF \
+#                  --save lextables.mk samples/*.decaf
+
+import argparse
+import os
+import subprocess
+import sys
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from bench import count_tokens, human, rate, run_once
+
+
+def section_sizes(path):
+    """Returns (text, data) bytes from size(1), or None without it."""
+    try:
+        out = subprocess.run(["size", path], stdout=subprocess.PIPE,
+                             stderr=subprocess.DEVNULL).stdout.split(b"\n")
+        fields = out[1].split()
+        return int(fields[0]), int(fields[1]) + int(fields[2])
+    except (OSError, IndexError, ValueError):
+        return None
+
+
+def best_time(cmd, path, repeat):
+    best, rc = None, 0
+    for _ in range(max(1, repeat)):
+        elapsed, rc, _ = run_once(cmd, path, False)
+        if best is None or elapsed < best:
+            best = elapsed
+    return best, rc
+
+
+def main():
+    p = argparse.ArgumentParser(description="Compare scanner table layouts.")
+    p.add_argument("--repeat", type=int, default=3,
+                   help="runs per file; the fastest one is counted")
+    p.add_argument("--variant", action="append", required=True,
+                   help="name=path of a dcc build (repeatable)")
+    p.add_argument("--save", metavar="FILE",
+                   help="write the fastest variant to FILE as LEXTABLES")
+    p.add_argument("files", nargs="+")
+    args = p.parse_args()
+
+    sizes = {}
+    for path in args.files:
+        with open(path, "rb") as f:
+            data = f.read()
+        sizes[path] = (len(data), count_tokens(data))
+
+    header = "%-8s %10s %10s %10s %10s %10s %10s" % (
+        "variant", "dcc bytes", "lex text", "lex data", "lex B/s",
+        "lex tok/s", "parse B/s")
+    print(header)
+    print("-" * len(header))
+    fastest = None
+    for spec in args.variant:
+        name, dcc = spec.split("=", 1)
+        obj = os.path.join(os.path.dirname(dcc), "lex-%s.yy.o" % name)
+        sec = section_sizes(obj) or ("?", "?")
+        lex_time = parse_time = 0.0
+        nbytes = ntokens = parse_bytes = 0
+        for path in args.files:
+            t, _ = best_time([dcc, "-d", "lexonly"], path, args.repeat)
+            lex_time += t
+            nbytes += sizes[path][0]
+            ntokens += sizes[path][1]
+            t, rc = best_time([dcc], path, args.repeat)
+            if rc == 0:
+                parse_time += t
+                parse_bytes += sizes[path][0]
+        print("%-8s %10d %10s %10s %10s %10s %10s" % (
+            name, os.path.getsize(dcc), sec[0], sec[1],
+            human(rate(nbytes, lex_time)), human(rate(ntokens, lex_time)),
+            human(rate(parse_bytes, parse_time))))
+        if fastest is None or lex_time < fastest[1]:
+            fastest = (name, lex_time)
+    print("fastest scanner: %s (LEXTABLES = -%s)" % (fastest[0], fastest[0]))
+    if args.save:
+        with open(args.save, "w") as f:
+            f.write("LEXTABLES = -%s\n" % fastest[0])
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,188 @@
+/* File: listbench.cc
+ * ------------------
+ * Microbenchmark for the List<T> container (list.h). For each element
+ * type the parser keeps in lists, and for a range of list lengths, it
+ * reports the time per element to
+ *
+ *   - append:   build a new list with Append,
+ *   - iterate:  visit every element with Nth, as SetParentAll and
+ *               PrintAll do,
+ *   - insert:   InsertAt the middle, n times, growing the list to 2n,
+ *   - remove:   RemoveAt the middle, n times, shrinking it back to n,
+ *
+ * and the memory used per element by a list of that length, the List
+ * object included. Memory is measured with the allocation census (see
+ * memstats.h), so it is what List asks for, not counting malloc's own
+ * overhead. Any replacement for List's underlying container should be
+ * compared on these numbers.
+ *
+ * The elements are never dereferenced, so they are made-up pointers and
+ * no nodes are created. Every length is run enough times to do a fixed
+ * amount of work, and the best of several rounds is reported.
+ *
+ *   make listbench && ./listbench [rounds]
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "list.h"
+#include "memstats.h"
+#include "timing.h"
+#include "utility.h"
+
+class Decl;
+class Stmt;
+class Expr;
+class VarDecl;
+
+static const int Lengths[] = { 1, 4, 16, 64, 1024, 65536 };
+static const int NumLengths = sizeof(Lengths) / sizeof(Lengths[0]);
+
+// Operations per measurement, and the longest list we try InsertAt and
+// RemoveAt on (each of those moves half the list)
+static const long WorkPerRun = 1 << 22;
+static const long ShuffleWorkPerRun = 1 << 16;
+static const int MaxShuffleLength = 1024;
+
+static int numRounds = 5;
+static volatile uintptr_t sink;   // keeps the loops from being optimized out
+
+typedef double (*benchFn)(int n, long reps);
+
+
+template<class T> static T Fake(long i)
+{
+  return reinterpret_cast<T>((uintptr_t)(i + 1) * 16);
+}
+
+template<class T> static void Fill(List<T> *list, int n)
+{
+  for (int i = 0; i < n; i++)
+    list->Append(Fake<T>(i));
+}
+
+/* Each of these returns the seconds taken to do its operation on n
+ * elements, reps times.
+ */
+template<class T> static double TimeAppend(int n, long reps)
+{
+  double start = Timing::Now();
+  for (long r = 0; r < reps; r++) {
+    List<T> *list = new List<T>;
+    Fill(list, n);
+    sink += list->NumElements();
+    delete list;
+  }
+  return Timing::Now() - start;
+}
+
+template<class T> static double TimeIterate(int n, long reps)
+{
+  List<T> list;
+  Fill(&list, n);
+  uintptr_t sum = 0;
+  double start = Timing::Now();
+  for (long r = 0; r < reps; r++)
+    for (int i = 0; i < list.NumElements(); i++)
+      sum += (uintptr_t)list.Nth(i);
+  double elapsed = Timing::Now() - start;
+  sink += sum;
+  return elapsed;
+}
+
+// Insert and remove each take the list between n and 2n elements long
+// and back; only their own half of the round trip is timed.
+template<class T> static double Shuffle(int n, long reps, bool timeInsert)
+{
+  List<T> list;
+  Fill(&list, n);
+  double elapsed = 0;
+  for (long r = 0; r < reps; r++) {
+    double start = Timing::Now();
+    for (int i = 0; i < n; i++)
+      list.InsertAt(Fake<T>(i), list.NumElements() / 2);
+    double middle = Timing::Now();
+    for (int i = 0; i < n; i++)
+      list.RemoveAt(list.NumElements() / 2);
+    elapsed += timeInsert ? middle - start : Timing::Now() - middle;
+  }
+  sink += list.NumElements();
+  return elapsed;
+}
+
+template<class T> static double TimeInsert(int n, long reps)
+{
+  return Shuffle<T>(n, reps, true);
+}
+
+template<class T> static double TimeRemove(int n, long reps)
+{
+  return Shuffle<T>(n, reps, false);
+}
+
+/* Returns the best time per element in nanoseconds over numRounds
+ * runs of fn, each doing about work operations.
+ */
+static double BestNs(benchFn fn, int n, long work)
+{
+  long reps = work / n;
+  if (reps < 1) reps = 1;
+  double best = -1;
+  for (int round = 0; round < numRounds; round++) {
+    double t = fn(n, reps);
+    if (best < 0 || t < best) best = t;
+  }
+  return best * 1e9 / ((double)reps * n);
+}
+
+/* The census is turned on (with the "alloc" key) only while measuring
+ * memory, so its counting is not in the times.
+ */
+template<class T> static double BytesPerElement(int n)
+{
+  SetDebugForKey("alloc", true);
+  MemStats::Init();
+  AllocBucket *b = ListBucket<T>();
+  long before = b->bytes;
+  List<T> *list = new List<T>;
+  Fill(list, n);
+  double perElement = (double)(b->bytes - before) / n;
+  delete list;
+  SetDebugForKey("alloc", false);
+  MemStats::Init();
+  return perElement;
+}
+
+template<class T> static void Run(const char *typeName)
+{
+  for (int i = 0; i < NumLengths; i++) {
+    int n = Lengths[i];
+    printf("%-10s %7d %9.2f %9.2f", typeName, n,
+           BestNs(TimeAppend<T>, n, WorkPerRun),
+           BestNs(TimeIterate<T>, n, WorkPerRun));
+    if (n <= MaxShuffleLength)
+      printf(" %9.2f %9.2f", BestNs(TimeInsert<T>, n, ShuffleWorkPerRun),
+             BestNs(TimeRemove<T>, n, ShuffleWorkPerRun));
+    else
+      printf(" %9s %9s", "-", "-");
+    printf(" %10.1f\n", BytesPerElement<T>(n));
+  }
+}
+
+
+int main(int argc, char *argv[])
+{
+  if (argc > 1) numRounds = atoi(argv[1]);
+  if (numRounds < 1) numRounds = 1;
+
+  printf("%-10s %7s %9s %9s %9s %9s %10s\n", "type", "length", "append",
+         "iterate", "insert", "remove", "bytes/elem");
+  printf("%-10s %7s %9s %9s %9s %9s %10s\n", "", "", "ns/elem", "ns/elem",
+         "ns/elem", "ns/elem", "");
+  Run<Decl*>("Decl*");
+  Run<Stmt*>("Stmt*");
+  Run<Expr*>("Expr*");
+  Run<VarDecl*>("VarDecl*");
+  return 0;
+}
@@ -0,0 +1,187 @@
+/* File: rescan.cc
+ * ---------------
+ * Checks incremental rescanning (TokenBuffer::Rescan, see tokenbuf.cc)
+ * against scanning from scratch. Each file is scanned into a token
+ * buffer and then edited at random a number of times, each edit made on
+ * the result of the one before: a few bytes at a random offset are
+ * replaced by a fragment that tends to upset the scanner (the start or
+ * end of a comment, a quote, a newline, half a double, an identifier
+ * and so on), or by nothing. After every edit the buffer is rescanned
+ * and compared, token by token, with a full scan of the edited source:
+ * codes, offsets, locations and values must all be the same. The time
+ * taken by both, and how many tokens each scanned, is reported. Before
+ * the random edits, edits that reach past the end of each file are
+ * checked to be refused (see SourceBuffer::Edit).
+ *
+ * Lexical errors the edits cause are reported as usual, by both scans,
+ * so stderr is best sent elsewhere.
+ *
+ *   make rescan && ./rescan [-e edits] [-s seed] files... 2>/dev/null
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include "scanner.h"
+#include "parser.h"
+#include "sourcebuf.h"
+#include "tokenbuf.h"
+#include "timing.h"
+
+static const char *Fragments[] = {
+  "", "", "/*", "*/", "//", "\"", "\n", "\t", " ", "x", "int", "1.", "1.5e",
+  "+", "e", "0x", "3", "=", "&&", "\"s\"", "/* c */", "{ a = b; }",
+};
+static const int NumFragments = sizeof(Fragments) / sizeof(Fragments[0]);
+
+static bool SameLocation(const yyltype &a, const yyltype &b)
+{
+#ifdef COMPACT_LOCATIONS
+  return a.offset == b.offset && a.length == b.length;
+#else
+  return a.first_line == b.first_line && a.first_column == b.first_column &&
+         a.last_column == b.last_column;
+#endif
+}
+
+// Whether the two buffers hold the same tokens, with the same values
+static bool SameTokens(TokenBuffer *a, TokenBuffer *b)
+{
+  if (a->NumTokens() != b->NumTokens()) return false;
+  a->Rewind();
+  b->Rewind();
+  YYSTYPE va, vb;
+  yyltype la, lb;
+  for (int i = 0; i < a->NumTokens(); i++) {
+    int kind = a->Next(&va, &la);
+    if (b->Next(&vb, &lb) != kind || a->GetStart(i) != b->GetStart(i) ||
+        a->GetLength(i) != b->GetLength(i) || !SameLocation(la, lb))
+      return false;
+    bool same = true;
+    switch (kind) {
+      case T_Identifier:     same = va.identifier == vb.identifier; break;
+      case T_StringConstant: same = va.stringConstant.text == vb.stringConstant.text &&
+                                    va.stringConstant.length == vb.stringConstant.length; break;
+      case T_IntConstant:    same = va.integerConstant == vb.integerConstant; break;
+      case T_BoolConstant:   same = va.boolConstant == vb.boolConstant; break;
+      case T_DoubleConstant: same = !memcmp(&va.doubleConstant, &vb.doubleConstant,
+                                            sizeof(double)); break;
+    }
+    if (!same) return false;
+  }
+  return true;
+}
+
+static TokenBuffer *ScanAll(SourceBuffer *source)
+{
+  Scanner *s = OpenScanner(source, 0, 1, 1);
+  TokenBuffer *b = TokenBuffer::Scan(s);
+  CloseScanner(s);
+  return b;
+}
+
+// Tries edits that reach past the end of source, and some that just
+// fit; returns the number that Edit got wrong
+static int CheckBounds(const char *name, SourceBuffer *source)
+{
+  size_t length = source->GetLength();
+  struct { size_t offset, removed; bool fits; } cases[] = {
+    { length, 0, true }, { 0, length, true },
+    { length + 1, 0, false }, { length, 1, false }, { 0, length + 1, false },
+    { 1, (size_t)-1, false }, { (size_t)-1, 2, false },
+  };
+  int wrong = 0;
+  for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+    SourceEdit edit = { cases[i].offset, cases[i].removed, "x", 1 };
+    errno = 0;
+    SourceBuffer *edited = source->Edit(edit);
+    if ((edited != NULL) != cases[i].fits ||
+        (edited == NULL && errno != EINVAL)) {
+      printf("BAD EDIT %s: at %zu, %zu bytes replaced %s\n", name,
+             edit.offset, edit.removed,
+             edited ? "instead of refused" : strerror(errno));
+      wrong++;
+    }
+    delete edited;
+  }
+  return wrong;
+}
+
+// Edits the file numEdits times; returns the number of mismatches
+static int EditFile(const char *name, int numEdits)
+{
+  SourceBuffer *source = SourceBuffer::Open(name);
+  if (source == NULL) {
+    fprintf(stderr, "rescan: cannot read %s: %s\n", name, strerror(errno));
+    return 1;
+  }
+  int mismatches = CheckBounds(name, source);
+  TokenBuffer *tokens = ScanAll(source);
+  double rescanTime = 0, fullTime = 0;
+  long rescanned = 0, fullScanned = 0;
+  for (int i = 0; i < numEdits; i++) {
+    SourceEdit edit;
+    size_t length = source->GetLength();
+    edit.offset = length ? rand() % (length + 1) : 0;
+    size_t most = length - edit.offset < 8 ? length - edit.offset : 8;
+    edit.removed = rand() % (most + 1);
+    edit.inserted = Fragments[rand() % NumFragments];
+    edit.insertedLength = strlen(edit.inserted);
+    SourceBuffer *edited = source->Edit(edit);
+    if (edited == NULL) break;
+
+    double start = Timing::Now();
+    rescanned += tokens->Rescan(edited, edit);
+    double middle = Timing::Now();
+    TokenBuffer *full = ScanAll(edited);
+    double end = Timing::Now();
+    rescanTime += middle - start;
+    fullTime += end - middle;
+    fullScanned += full->NumTokens();
+
+    if (!SameTokens(tokens, full)) {
+      printf("MISMATCH %s, edit %d: at %zu, %zu bytes replaced by \"%s\"\n",
+             name, i + 1, edit.offset, edit.removed, edit.inserted);
+      mismatches++;
+      delete tokens;
+      tokens = full;  // go on from a correct buffer
+    } else
+      delete full;
+    delete source;
+    source = edited;
+  }
+  printf("%s: %d edits, %d differ\n", name, numEdits, mismatches);
+  if (numEdits > 0)
+    printf("  rescan  %9.3fms  %9.1f tokens per edit\n"
+           "  full    %9.3fms  %9.1f tokens per edit\n",
+           rescanTime * 1000 / numEdits, (double)rescanned / numEdits,
+           fullTime * 1000 / numEdits, (double)fullScanned / numEdits);
+  delete tokens;
+  delete source;
+  return mismatches;
+}
+
+
+int main(int argc, char *argv[])
+{
+  int numEdits = 200;
+  unsigned seed = 1;
+  int i = 1;
+  for (; i + 1 < argc && argv[i][0] == '-'; i += 2) {
+    if (strcmp(argv[i], "-e") == 0) numEdits = atoi(argv[i+1]);
+    else if (strcmp(argv[i], "-s") == 0) seed = atoi(argv[i+1]);
+    else break;
+  }
+  if (i >= argc) {
+    fprintf(stderr, "usage: rescan [-e edits] [-s seed] files...\n");
+    return 2;
+  }
+  srand(seed);
+
+  int mismatches = 0;
+  for (; i < argc; i++)
+    mismatches += EditFile(argv[i], numEdits);
+  printf("%s\n", mismatches ? "rescans differ" : "rescans agree");
+  return mismatches ? 1 : 0;
+}
@@ -0,0 +1,187 @@
+/* File: scanthreads.cc
+ * --------------------
+ * Checks that scanners are independent (see scanner.h) by scanning
+ * files on several threads at once. Each file is first scanned on its
+ * own, and then all of them are scanned again by a pool of threads that
+ * take the next file as they finish one. For every scan we keep a
+ * digest of the tokens: each token code, its location and its value
+ * (identifiers by name, since symbol numbers depend on the order names
+ * were first seen). The threaded digests must match the sequential
+ * ones. Both passes are timed.
+ *
+ * With -p the files are parsed rather than just scanned, each with a
+ * CompileContext of its own (see context.h), and the digest is of
+ * whether the parse succeeded and how many errors it reported. The
+ * trees aren't printed.
+ *
+ *   make scanthreads && ./scanthreads [-p] [-t threads] [-r rounds] files...
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <atomic>
+#include <thread>
+#include <vector>
+#include "scanner.h"
+#include "parser.h"
+#include "intern.h"
+#include "timing.h"
+#include "context.h"
+
+struct FileScan {
+  const char *name;
+  uint64_t digest;
+  long tokens;
+  bool ok;
+};
+
+static void Mix(uint64_t &h, const void *data, size_t length)
+{
+  const unsigned char *p = (const unsigned char *)data;
+  for (size_t i = 0; i < length; i++)
+    h = (h ^ p[i]) * 1099511628211ull;
+}
+
+static void Mix(uint64_t &h, long n)
+{
+  Mix(h, &n, sizeof(n));
+}
+
+static bool parsing;   // -p: parse the files rather than just scan them
+
+// Parses the file with s, filling in its digest
+static void ParseFile(FileScan *f, Scanner *s)
+{
+  CompileContext context(s);
+  uint64_t h = 14695981039346656037ull;
+  Mix(h, context.Parse());
+  Mix(h, context.NumErrors());
+  Mix(h, context.GetProgram() != NULL);
+  f->digest = h;
+  f->tokens = 0;
+  f->ok = true;
+}
+
+// Scans the whole file, filling in its digest and token count
+static void ScanFile(FileScan *f)
+{
+  Scanner *s = OpenScanner(f->name);
+  if (s == NULL) {
+    fprintf(stderr, "scanthreads: cannot read %s: %s\n", f->name,
+            strerror(errno));
+    f->ok = false;
+    return;
+  }
+  if (parsing) {
+    ParseFile(f, s);
+    return;
+  }
+  YYSTYPE value;
+  yyltype loc;
+  uint64_t h = 14695981039346656037ull;
+  long n = 0;
+  int token;
+  while ((token = ScanToken(s, &value, &loc)) != 0) {
+    n++;
+    Mix(h, token);
+#ifdef COMPACT_LOCATIONS
+    Mix(h, loc.offset);
+    Mix(h, loc.length);
+#else
+    Mix(h, loc.first_line);
+    Mix(h, loc.first_column);
+    Mix(h, loc.last_column);
+#endif
+    switch (token) {
+      case T_Identifier:
+        Mix(h, InternTable::GetName(value.identifier),
+            InternTable::GetLength(value.identifier));
+        break;
+      case T_StringConstant:
+        Mix(h, value.stringConstant.text, value.stringConstant.length);
+        break;
+      case T_IntConstant:    Mix(h, value.integerConstant); break;
+      case T_BoolConstant:   Mix(h, value.boolConstant); break;
+      case T_DoubleConstant: Mix(h, &value.doubleConstant, sizeof(double)); break;
+    }
+  }
+  CloseScanner(s);
+  f->digest = h;
+  f->tokens = n;
+  f->ok = true;
+}
+
+// Scans (or parses) every file in files once, on numThreads threads
+static void ScanAll(std::vector<FileScan> &files, int numThreads)
+{
+  std::atomic<size_t> next(0);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < numThreads; t++)
+    threads.push_back(std::thread([&files, &next]() {
+      for (size_t i; (i = next++) < files.size(); )
+        ScanFile(&files[i]);
+    }));
+  for (size_t t = 0; t < threads.size(); t++)
+    threads[t].join();
+}
+
+
+int main(int argc, char *argv[])
+{
+  int numThreads = std::thread::hardware_concurrency();
+  int rounds = 1;
+  int i = 1;
+  for (; i < argc && argv[i][0] == '-'; i++) {
+    if (strcmp(argv[i], "-p") == 0) parsing = true;
+    else if (i + 1 >= argc) break;
+    else if (strcmp(argv[i], "-t") == 0) numThreads = atoi(argv[++i]);
+    else if (strcmp(argv[i], "-r") == 0) rounds = atoi(argv[++i]);
+    else break;
+  }
+  if (i >= argc) {
+    fprintf(stderr, "usage: scanthreads [-p] [-t threads] [-r rounds] files...\n");
+    return 2;
+  }
+  if (parsing) InitParser();
+  if (numThreads < 1) numThreads = 1;
+  if (rounds < 1) rounds = 1;
+
+  // Each round scans every file once more, so the pool has enough to do
+  std::vector<FileScan> sequential, threaded;
+  for (int r = 0; r < rounds; r++)
+    for (int j = i; j < argc; j++) {
+      FileScan f = { argv[j], 0, 0, false };
+      sequential.push_back(f);
+    }
+  threaded = sequential;
+
+  double start = Timing::Now();
+  ScanAll(sequential, 1);
+  double middle = Timing::Now();
+  ScanAll(threaded, numThreads);
+  double end = Timing::Now();
+
+  int mismatches = 0;
+  long tokens = 0;
+  for (size_t j = 0; j < sequential.size(); j++) {
+    tokens += sequential[j].tokens;
+    if (sequential[j].ok != threaded[j].ok ||
+        sequential[j].digest != threaded[j].digest ||
+        sequential[j].tokens != threaded[j].tokens) {
+      printf("MISMATCH %s: %ld tokens alone, %ld on threads\n",
+             sequential[j].name, sequential[j].tokens, threaded[j].tokens);
+      mismatches++;
+    }
+  }
+  if (parsing)
+    printf("%zu parses\n", sequential.size());
+  else
+    printf("%zu scans, %ld tokens\n", sequential.size(), tokens);
+  printf("  1 thread    %9.2fms\n", (middle - start) * 1000);
+  printf("  %-2d threads  %9.2fms  (%.2fx)\n", numThreads, (end - middle) * 1000,
+         (end - middle) > 0 ? (middle - start) / (end - middle) : 0.0);
+  printf("%s\n", mismatches ? "threaded runs differ" : "threaded runs agree");
+  return mismatches ? 1 : 0;
+}
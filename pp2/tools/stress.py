@@ -0,0 +1,134 @@
+#!/usr/bin/env python3
+# File: stress.py
+# ---------------
+# Runs dcc on deeply nested programs (see gendeep.py) to find the
+# deepest nesting of each shape it survives, and how parse and print
+# time grow with depth. For each shape the depth is doubled from --start
+# until dcc fails or --max is reached; after a failure, a binary search
+# between the last depth that worked and the first that failed finds the
+# exact limit.
+#
+# A run fails if dcc crashes (e.g. runs out of C stack in the recursive
+# Node::Print), reports an error (bison reports "memory exhausted" when
+# its own stack is full), or takes longer than --timeout seconds. Times
+# come from dcc -d timing: "parse" is the scan, parse and build phases
+# together, "print" the printing of the tree.
+#
+#   stress.py --dcc ./dcc --shapes chain parens --max 100000
+
+import argparse
+import os
+import re
+import signal
+import subprocess
+import sys
+import tempfile
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+import gendeep
+
+PHASE_RE = re.compile(r"^(.+?)\s+([\d.]+)\s+\d+\s+[\d.]+%$", re.MULTILINE)
+PARSE_PHASES = ["scan", "parse", "build (actions)"]
+
+
+def run(dcc, shape, depth, timeout):
+    """Runs dcc on one program; returns a dict describing the run."""
+    text = gendeep.generate(shape, depth)
+    with tempfile.TemporaryFile() as src:
+        src.write(text.encode())
+        src.seek(0)
+        try:
+            proc = subprocess.run([dcc, "-d", "timing"], stdin=src,
+                                  stdout=subprocess.DEVNULL,
+                                  stderr=subprocess.PIPE, timeout=timeout)
+        except subprocess.TimeoutExpired:
+            return {"depth": depth, "bytes": len(text), "ok": False,
+                    "status": "timeout"}
+
+    err = proc.stderr.decode(errors="replace")
+    result = {"depth": depth, "bytes": len(text), "ok": proc.returncode == 0}
+    if proc.returncode < 0:
+        result["status"] = "crash (%s)" % signal.Signals(-proc.returncode).name
+    elif proc.returncode != 0:
+        messages = [l[4:] for l in err.splitlines()
+                    if l.startswith("*** ") and not l.startswith("*** Error")]
+        result["status"] = "error: " + (messages[0] if messages else "?")
+    else:
+        result["status"] = "ok"
+    phases = dict((m.group(1).strip(), float(m.group(2)))
+                  for m in PHASE_RE.finditer(err))
+    if phases:
+        result["parse_ms"] = sum(phases.get(p, 0.0) for p in PARSE_PHASES)
+        result["print_ms"] = phases.get("print", 0.0)
+    return result
+
+
+def report(shape, r):
+    times = ("%10.2f %10.2f" % (r["parse_ms"], r["print_ms"])
+             if "parse_ms" in r else "%10s %10s" % ("-", "-"))
+    print("%-8s %9d %11d %s  %s" % (shape, r["depth"], r["bytes"], times,
+                                    r["status"]))
+    sys.stdout.flush()
+
+
+def probe(dcc, shape, args):
+    """Returns (deepest depth that worked, first failing run or None)."""
+    good, bad = 0, None
+    depth = args.start
+    while depth <= args.max:
+        r = run(dcc, shape, depth, args.timeout)
+        report(shape, r)
+        if not r["ok"]:
+            bad = r
+            break
+        good = depth
+        depth *= 2
+    if bad is None:
+        return good, None
+
+    # Binary search for the limit, between good (or 0) and bad
+    while bad["depth"] - good > 1:
+        mid = (good + bad["depth"]) // 2
+        r = run(dcc, shape, mid, args.timeout)
+        if r["ok"]:
+            good = mid
+        else:
+            bad = r
+    if args.verbose:
+        report(shape, bad)
+    return good, bad
+
+
+def main():
+    p = argparse.ArgumentParser(description="Find how deep dcc can nest.")
+    p.add_argument("--dcc", default="./dcc", help="path to the compiler")
+    p.add_argument("--shapes", nargs="+", choices=gendeep.SHAPES,
+                   default=gendeep.SHAPES)
+    p.add_argument("--start", type=int, default=16, help="first depth tried")
+    p.add_argument("--max", type=int, default=1 << 20,
+                   help="deepest depth tried")
+    p.add_argument("--timeout", type=float, default=60,
+                   help="seconds before a run counts as stalled")
+    p.add_argument("-v", "--verbose", action="store_true",
+                   help="also show the failing run the search ends on")
+    args = p.parse_args()
+
+    print("%-8s %9s %11s %10s %10s  %s" % ("shape", "depth", "bytes",
+                                           "parse ms", "print ms", "status"))
+    limits = []
+    for shape in args.shapes:
+        limits.append((shape,) + probe(args.dcc, shape, args))
+
+    print("\n%-8s %12s %12s  %s" % ("shape", "max depth", "fails at",
+                                    "failure"))
+    for shape, good, bad in limits:
+        if bad is None:
+            print("%-8s %12d %12s  %s" % (shape, good, "-",
+                                          "none up to --max"))
+        else:
+            print("%-8s %12d %12d  %s" % (shape, good, bad["depth"],
+                                          bad["status"]))
+
+
+if __name__ == "__main__":
+    main()
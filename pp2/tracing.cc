@@ -0,0 +1,91 @@
+/* File: tracing.cc
+ * ----------------
+ * Implementation of the trace event writer.
+ */
+
+#include "tracing.h"
+#include <unistd.h>   // for getpid
+#include "utility.h"
+#include "timing.h"
+
+FILE *Trace::out = NULL;
+double Trace::origin = 0;
+
+static const char *TraceFileName = "dcc.trace.json";
+
+
+void Trace::Init()
+{
+  if (!IsDebugOn("trace")) return;
+  out = fopen(TraceFileName, "w");
+  if (!out) {
+    perror(TraceFileName);
+    return;
+  }
+  origin = Timing::Now();
+  fprintf(out, "[\n");
+}
+
+/* Writes s as a JSON string, with quotes. Control characters other than
+ * tab and newline (which are escaped) can't appear in our names or
+ * messages, so they are written as spaces.
+ */
+void Trace::WriteString(const char *s)
+{
+  putc('"', out);
+  for (; *s; s++) {
+    switch (*s) {
+      case '"':  fputs("\\\"", out); break;
+      case '\\': fputs("\\\\", out); break;
+      case '\n': fputs("\\n", out); break;
+      case '\t': fputs("\\t", out); break;
+      default:   putc((unsigned char)*s < ' ' ? ' ' : *s, out); break;
+    }
+  }
+  putc('"', out);
+}
+
+/* Times are in microseconds since Init, as the format expects. Each
+ * event ends with a comma; the format allows one before the closing
+ * bracket, and the bracket itself may be missing.
+ */
+void Trace::WriteEvent(char phase, const char *name, const char *category,
+                       double start, int line, const char *detail)
+{
+  double now = (Timing::Now() - origin) * 1e6;
+  fprintf(out, "{\"ph\":\"%c\",\"pid\":%d,\"tid\":1", phase, (int)getpid());
+  if (name) {
+    fputs(",\"name\":", out);
+    WriteString(name);
+  }
+  if (category) {
+    fputs(",\"cat\":", out);
+    WriteString(category);
+  }
+  if (phase == 'X') {
+    double begin = (start - origin) * 1e6;
+    fprintf(out, ",\"ts\":%.3f,\"dur\":%.3f", begin, now - begin);
+  } else
+    fprintf(out, ",\"ts\":%.3f", now);
+  if (phase == 'i')
+    fputs(",\"s\":\"t\"", out);
+  if (line || detail) {
+    fputs(",\"args\":{", out);
+    if (line) fprintf(out, "\"line\":%d%s", line, detail ? "," : "");
+    if (detail) {
+      fputs("\"detail\":", out);
+      WriteString(detail);
+    }
+    putc('}', out);
+  }
+  fputs("},\n", out);
+}
+
+void Trace::Finish()
+{
+  if (!out) return;
+  fprintf(out, "{\"ph\":\"M\",\"pid\":%d,\"tid\":1,\"name\":\"process_name\","
+          "\"args\":{\"name\":\"dcc\"}}\n]\n", (int)getpid());
+  fclose(out);
+  out = NULL;
+}
@@ -0,0 +1,63 @@
+/* File: tracing.h
+ * ---------------
+ * This file defines a writer for trace events in the Chrome trace event
+ * format, which can be loaded into chrome://tracing or ui.perfetto.dev
+ * to see a compile on a timeline. Tracing is turned on with the "trace"
+ * debug key (dcc -d trace) and the events are written to dcc.trace.json
+ * in the current directory as they happen.
+ *
+ * The file uses the "JSON array" form of the format, which viewers accept
+ * without the closing bracket, so a trace is still readable if dcc dies
+ * part way through.
+ *
+ * Events are either spans, with a start and a duration, or instants that
+ * mark a single point in time. Spans are written with Begin/End pairs,
+ * which must nest, or with Complete when the start time was saved
+ * earlier (from Timing::Now).
+ */
+
+#ifndef _H_tracing
+#define _H_tracing
+
+#include <stdio.h>
+
+class Trace
+{
+ public:
+
+  // Turns tracing on if the "trace" debug key is set, opening the file
+  static void Init();
+
+  static bool IsOn() { return out != NULL; }
+
+  // Starts a span; it ends at the next End() not matched by a Begin
+  static void Begin(const char *name, const char *category)
+      { if (out) WriteEvent('B', name, category, 0, 0, NULL); }
+  static void End()
+      { if (out) WriteEvent('E', NULL, NULL, 0, 0, NULL); }
+
+  // A span from start (a Timing::Now() value) until now. line and detail
+  // are shown as arguments of the event if given.
+  static void Complete(const char *name, const char *category, double start,
+                       int line = 0, const char *detail = NULL)
+      { if (out) WriteEvent('X', name, category, start, line, detail); }
+
+  // A single point in time
+  static void Instant(const char *name, const char *category,
+                      int line = 0, const char *detail = NULL)
+      { if (out) WriteEvent('i', name, category, 0, line, detail); }
+
+  // Closes the event list and the file
+  static void Finish();
+
+ private:
+
+  static void WriteEvent(char phase, const char *name, const char *category,
+                         double start, int line, const char *detail);
+  static void WriteString(const char *s);
+
+  static FILE *out;
+  static double origin;
+};
+
+#endif
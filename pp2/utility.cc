@@ -72,7 +72,7 @@ void ParseCommandLine(int argc, char *argv[])
     return;
   
   if (strcmp(argv[1], "-d") != 0) { // first arg is not -d
-    printf("Usage:   -d <debug-key-1> <debug-key-2> ... \n");
+    printf("Usage:   dcc [file] [-d <debug-key-1> <debug-key-2> ...]\n");
     exit(2);
   }
 